@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Conjunto de arcos de precedência (i -> j) em hash de endereçamento
+ * aberto.
+ * * Responde em O(1) esperado se j é sucessor direto de i, sem percorrer listas
+ * de sucessores (o nó fonte das instâncias geradas tem milhares deles). A
+ * tabela tem potência de dois posições, no máximo meio cheia, e a chave 0 marca
+ * posição vazia.
+ */
+struct arc_set
+{
+    std::vector<std::uint64_t> table;
+    std::uint64_t mask = 0;
+
+    /// @brief Limpa o conjunto e dimensiona a tabela para number_of_arcs arcos.
+    void reset(std::size_t number_of_arcs) {
+        std::size_t size = 16;
+        while (size < 2 * number_of_arcs) size *= 2;
+        table.assign(size, 0);
+        mask = size - 1;
+    }
+
+    void insert(int from, int to) {
+        std::uint64_t key = make_key(from, to);
+        std::uint64_t slot = hash(key);
+        while (table[slot] != 0 && table[slot] != key) slot = (slot + 1) & mask;
+        table[slot] = key;
+    }
+
+    bool contains(int from, int to) const {
+        if (table.empty()) return false;
+        std::uint64_t key = make_key(from, to);
+        std::uint64_t slot = hash(key);
+        while (table[slot] != 0) {
+            if (table[slot] == key) return true;
+            slot = (slot + 1) & mask;
+        }
+        return false;
+    }
+
+    private:
+    static std::uint64_t make_key(int from, int to) {
+        return ((std::uint64_t)(std::uint32_t)from << 32 | (std::uint32_t)to) + 1;
+    }
+
+    std::uint64_t hash(std::uint64_t key) const {
+        key *= 0x9E3779B97F4A7C15ull;
+        return (key ^ (key >> 29)) & mask;
+    }
+};
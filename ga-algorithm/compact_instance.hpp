@@ -0,0 +1,145 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Lista de adjacência em CSR (compressed sparse row): os vizinhos do
+ * nó j ficam em ids[offsets[j], offsets[j + 1]), todos num único vetor.
+ * * Percorrer os predecessores/sucessores de várias tarefas lê memória
+ * contígua, em vez de saltar entre os vetores de cada node; o nó fonte das
+ * instâncias grandes, com dezenas de milhares de sucessores, vira só um
+ * trecho de ids.
+ */
+struct csr_adjacency
+{
+    /// @brief Intervalo de vizinhos de um nó, para uso em range-for.
+    struct range
+    {
+        const std::int32_t *first;
+        const std::int32_t *last;
+        const std::int32_t *begin() const { return first; }
+        const std::int32_t *end() const { return last; }
+        std::size_t size() const { return (std::size_t)(last - first); }
+    };
+
+    std::vector<std::int32_t> offsets;
+    std::vector<std::int32_t> ids;
+
+    /**
+     * @brief Monta a partir de n listas; neighbors(j) devolve a lista do nó j
+     * (qualquer contêiner de inteiros).
+     */
+    template <class Neighbors> void assign(int n, Neighbors &&neighbors) {
+        offsets.assign((std::size_t)n + 1, 0);
+        for (int j = 0; j < n; ++j) offsets[j + 1] = offsets[j] + (std::int32_t)neighbors(j).size();
+        ids.resize(offsets[n]);
+        for (int j = 0; j < n; ++j) {
+            const auto &list = neighbors(j);
+            std::copy(list.begin(), list.end(), ids.begin() + offsets[j]);
+        }
+    }
+
+    range operator[](int j) const { return {ids.data() + offsets[j], ids.data() + offsets[j + 1]}; }
+
+    std::size_t bytes() const { return (offsets.size() + ids.size()) * sizeof(std::int32_t); }
+};
+
+/**
+ * @brief Coluna de inteiros não negativos guardada no tipo mais estreito
+ * que comporta o maior valor: uint8_t, uint16_t ou int32_t (este também
+ * para colunas com valores negativos).
+ * * A leitura escolhe o vetor pela largura a cada acesso; como a largura é a
+ * mesma durante toda a decodificação, o desvio é sempre previsto.
+ */
+struct packed_column
+{
+    int width = 4;
+    std::vector<std::uint8_t> narrow8;
+    std::vector<std::uint16_t> narrow16;
+    std::vector<std::int32_t> wide;
+
+    template <class Values> void assign(const Values &values) {
+        int low = 0, high = 0;
+        for (int v : values) {
+            low = std::min(low, v);
+            high = std::max(high, v);
+        }
+        width = low < 0 || high > UINT16_MAX ? 4 : high > UINT8_MAX ? 2 : 1;
+
+        narrow8.clear();
+        narrow16.clear();
+        wide.clear();
+        if (width == 1) narrow8.assign(values.begin(), values.end());
+        else if (width == 2) narrow16.assign(values.begin(), values.end());
+        else wide.assign(values.begin(), values.end());
+    }
+
+    int operator[](std::size_t i) const {
+        switch (width) {
+            case 1: return narrow8[i];
+            case 2: return narrow16[i];
+            default: return wide[i];
+        }
+    }
+
+    std::size_t size() const { return width == 1 ? narrow8.size() : width == 2 ? narrow16.size() : wide.size(); }
+
+    std::size_t bytes() const { return size() * width; }
+
+    const char *type_name() const { return width == 1 ? "uint8" : width == 2 ? "uint16" : "int32"; }
+};
+
+/**
+ * @brief Layout imutável da instância usado pelos decodificadores: grafo em
+ * CSR, durações e demandas em colunas estreitas e os tempos do CPM em vetores
+ * separados, um por tempo.
+ * * É montado a partir dos node do project ao final da leitura
+ * (project::build_precedence_index) e não muda durante o GA; node continua
+ * sendo a representação de leitura/escrita da instância.
+ */
+struct compact_instance
+{
+    int number_of_jobs = 0;
+    int number_of_resources = 0;
+
+    csr_adjacency predecessors;
+    csr_adjacency successors;
+    packed_column durations;
+    /// Demanda do recurso k da tarefa j em requests[j * number_of_resources + k].
+    packed_column requests;
+
+    /// Tempos do CPM (vazios até o CPM ser calculado).
+    std::vector<std::int32_t> earliest_start;
+    std::vector<std::int32_t> earliest_finish;
+    std::vector<std::int32_t> latest_start;
+    std::vector<std::int32_t> latest_finish;
+
+    int duration(int j) const { return durations[(std::size_t)j]; }
+
+    int request(int j, int k) const { return requests[(std::size_t)j * number_of_resources + k]; }
+
+    /// @brief Bytes ocupados por parte do layout (capacidade usada, sem o
+    /// cabeçalho dos vetores).
+    struct memory_usage
+    {
+        std::size_t graph = 0;
+        std::size_t durations = 0;
+        std::size_t requests = 0;
+        std::size_t cpm = 0;
+
+        std::size_t total() const { return graph + durations + requests + cpm; }
+    };
+
+    memory_usage memory() const {
+        memory_usage usage;
+        usage.graph = predecessors.bytes() + successors.bytes();
+        usage.durations = durations.bytes();
+        usage.requests = requests.bytes();
+        usage.cpm = (earliest_start.size() + earliest_finish.size() + latest_start.size() + latest_finish.size()) *
+                    sizeof(std::int32_t);
+        return usage;
+    }
+};
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "compact_instance.hpp"
+
+/**
+ * @brief Cronogramas por padrão cíclico para instâncias com muitos pacientes
+ * idênticos (project::solve_by_pattern).
+ * * Um bloco é o cronograma de k pacientes, obtido numa instância pequena. As
+ * cópias do bloco deslocadas de P em P unidades de tempo só disputam os
+ * recursos (pacientes diferentes não têm arcos entre si): o consumo de todas
+ * as cópias no instante t é a soma do consumo do bloco em t, t - P, t - 2P...
+ * Se o perfil do bloco dobrado módulo P cabe nas capacidades, qualquer número
+ * de cópias (ou de pacientes tirados delas) cabe.
+ */
+namespace cyclic_pattern {
+
+/**
+ * @brief Menor período P >= lowest em que as cópias do bloco cabem; com
+ * P = makespan as cópias não se sobrepõem, então a busca sempre termina.
+ * Custa O(makespan * K) por período testado.
+ * @param start início de cada atividade do bloco (ids de block)
+ * @param lowest limitante do período (trabalho do bloco / capacidade)
+ */
+inline int minimum_period(const compact_instance &block, const std::vector<int> &capacity,
+                          const std::vector<int> &start, int makespan, int lowest) {
+    int K = block.number_of_resources;
+    std::vector<int> usage((std::size_t)makespan * K, 0);
+    for (int j = 0; j < block.number_of_jobs; ++j) {
+        for (int t = start[j]; t < start[j] + block.duration(j); ++t) {
+            for (int k = 0; k < K; ++k) usage[(std::size_t)t * K + k] += block.request(j, k);
+        }
+    }
+
+    std::vector<int> folded;
+    for (int period = std::max(1, lowest); period < makespan; ++period) {
+        folded.assign((std::size_t)period * K, 0);
+        bool fits = true;
+        for (int t = 0; t < makespan && fits; ++t) {
+            int *row = folded.data() + (std::size_t)(t % period) * K;
+            for (int k = 0; k < K; ++k) {
+                row[k] += usage[(std::size_t)t * K + k];
+                fits = fits && row[k] <= capacity[k];
+            }
+        }
+        if (fits) return period;
+    }
+    return makespan;
+}
+
+/**
+ * @brief Serial SGS sobre o perfil dobrado: decodifica a lista do bloco de
+ * modo que as cópias deslocadas de period em period caibam. Cada atividade
+ * entra no primeiro início t >= término dos predecessores em que seu consumo
+ * nos instantes t .. t + duração - 1, somado ao já reservado nas mesmas
+ * posições módulo period, cabe; inícios além de t + period repetiriam as
+ * mesmas posições, então se nenhum couber o período é curto demais.
+ * @param list lista de atividades (todas as de block) viável quanto às precedências
+ * @param start recebe os inícios (ids de block)
+ * @return int Makespan do bloco, ou -1 se a lista não cabe no período.
+ */
+inline int periodic_serial_decode(const compact_instance &block, const std::vector<int> &capacity,
+                                  const int *list, int period, std::vector<int> &start) {
+    int K = block.number_of_resources;
+    std::vector<int> folded((std::size_t)period * K, 0);
+    start.assign(block.number_of_jobs, 0);
+    int makespan = 0;
+
+    for (int position = 0; position < block.number_of_jobs; ++position) {
+        int j = list[position];
+        int duration = block.duration(j);
+        int release = 0;
+        for (int p : block.predecessors[j]) {
+            if (p != j) release = std::max(release, start[p] + block.duration(p));
+        }
+
+        // posição i da atividade cai em folded[(t + i) % period] duration / period vezes (+1 se i < resto)
+        int span = std::min(duration, period);
+        auto fits = [&](int t) {
+            for (int i = 0; i < span; ++i) {
+                const int *row = folded.data() + (std::size_t)((t + i) % period) * K;
+                int hits = duration / period + (i < duration % period);
+                for (int k = 0; k < K; ++k) {
+                    if (row[k] + hits * block.request(j, k) > capacity[k]) return false;
+                }
+            }
+            return true;
+        };
+        int t = release;
+        while (t < release + period && !fits(t)) ++t;
+        if (t == release + period) return -1;
+
+        start[j] = t;
+        for (int i = 0; i < span; ++i) {
+            int *row = folded.data() + (std::size_t)((t + i) % period) * K;
+            int hits = duration / period + (i < duration % period);
+            for (int k = 0; k < K; ++k) row[k] += hits * block.request(j, k);
+        }
+        makespan = std::max(makespan, t + duration);
+    }
+    return makespan;
+}
+
+/**
+ * @brief Consumo dos recursos instante a instante. Verificar e reservar uma
+ * atividade custa O(duração * K), sem depender de quantas já foram
+ * reservadas (o resource_profile por segmentos cresce com o número de
+ * mudanças de consumo); a memória é O(horizonte * K). Instantes além do fim
+ * do vetor estão livres.
+ */
+struct time_indexed_profile
+{
+    int number_of_resources = 0;
+    std::vector<int> capacity;
+    /// Consumo do recurso k no instante t em used[t * K + k].
+    std::vector<int> used;
+
+    void reset(const std::vector<int> &capacities, int horizon) {
+        number_of_resources = (int)capacities.size();
+        capacity = capacities;
+        used.assign((std::size_t)std::max(0, horizon) * number_of_resources, 0);
+    }
+
+    /// @brief Primeiro instante de [start, start + duration) sem espaço para request, ou -1.
+    int first_conflict(int start, int duration, const int *request) const {
+        int K = number_of_resources;
+        int end = std::min<long long>(start + duration, used.size() / std::max(1, K));
+        for (int t = start; t < end; ++t) {
+            const int *row = used.data() + (std::size_t)t * K;
+            for (int k = 0; k < K; ++k) {
+                if (row[k] + request[k] > capacity[k]) return t;
+            }
+        }
+        return -1;
+    }
+
+    /// @brief Menor início em [earliest, latest] em que a atividade cabe (latest < 0 = sem limite).
+    int earliest_fit(int earliest, int latest, int duration, const int *request) const {
+        int t = earliest;
+        while (latest < 0 || t < latest) {
+            int conflict = first_conflict(t, duration, request);
+            if (conflict < 0) return t;
+            t = conflict + 1;
+        }
+        return latest;
+    }
+
+    /// @brief Soma sign * request em [start, start + duration).
+    void book(int start, int duration, const int *request, int sign = 1) {
+        int K = number_of_resources;
+        if ((std::size_t)(start + duration) * K > used.size()) used.resize((std::size_t)(start + duration) * K, 0);
+        for (int t = start; t < start + duration; ++t) {
+            int *row = used.data() + (std::size_t)t * K;
+            for (int k = 0; k < K; ++k) row[k] += sign * request[k];
+        }
+    }
+};
+
+} // namespace cyclic_pattern
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "list_hash.hpp"
+
+/**
+ * @brief Cache limitado de fitness por activity_list.
+ * * Listas repetidas (mutação desfeita, pais quase iguais, cópias de elite) são
+ * comuns em populações pequenas; o cache devolve o makespan sem decodificar.
+ * A chave é um hash de 64 bits da lista, mas a igualdade é sempre conferida com
+ * a lista inteira, guardada na entrada.
+ * * A tabela é de endereçamento aberto com sondagem linear limitada a
+ * max_probes posições: se todas estão ocupadas, a entrada da posição inicial é
+ * substituída (a memória nunca cresce além de capacity listas). Para uso com
+ * várias threads a tabela é dividida em shards, cada um com o seu mutex,
+ * escolhidos pelos bits altos do hash.
+ * * Opcionalmente cada entrada guarda também a lista resultante da avaliação
+ * (com a canonização, a lista reescrita na ordem do cronograma), devolvida
+ * no acerto para que o slot fique igual ao que a decodificação deixaria.
+ */
+struct fitness_cache
+{
+    static constexpr int number_of_shards = 16;
+    static constexpr int max_probes = 8;
+
+    struct shard
+    {
+        std::mutex lock;
+        /// 0 = posição vazia (hash_activity_list nunca devolve 0).
+        std::vector<std::uint64_t> hashes;
+        std::vector<double> fitness;
+        /// Listas das entradas, number_of_jobs inteiros por posição. Não é
+        /// inicializado: as páginas só são tocadas quando uma lista é inserida.
+        std::unique_ptr<int[]> lists;
+        /// Listas resultantes (só com store_results).
+        std::unique_ptr<int[]> results;
+    };
+
+    int number_of_jobs = 0;
+    /// Posições por shard (potência de dois; 0 = cache desligado).
+    std::size_t shard_capacity = 0;
+    bool store_results = false;
+    std::vector<shard> shards;
+
+    /**
+     * @brief Limpa e dimensiona o cache para cerca de entries listas de
+     * 'jobs' atividades (0 desliga). A capacidade é arredondada para potência de
+     * dois por shard.
+     * @param results guardar a lista resultante de cada entrada (dobra a memória)
+     */
+    void configure(int jobs, std::size_t entries, bool results = false) {
+        number_of_jobs = jobs;
+        store_results = results;
+        shard_capacity = 0;
+        if (entries > 0) {
+            shard_capacity = 1;
+            while (shard_capacity * number_of_shards < entries) shard_capacity *= 2;
+        }
+
+        shards = std::vector<shard>(shard_capacity > 0 ? number_of_shards : 0);
+        for (shard &s : shards) {
+            s.hashes.assign(shard_capacity, 0);
+            s.fitness.assign(shard_capacity, 0.0);
+            s.lists.reset(new int[shard_capacity * number_of_jobs]);
+            s.results.reset(store_results ? new int[shard_capacity * number_of_jobs] : nullptr);
+        }
+    }
+
+    bool enabled() const { return shard_capacity > 0; }
+
+    std::uint64_t hash(const int *list) const { return hash_activity_list(list, number_of_jobs); }
+
+    /**
+     * @brief Procura a lista; em caso de acerto escreve o fitness (e, com
+     * store_results, a lista resultante em result).
+     * @param h hash(list), calculado uma vez para a consulta e a inserção.
+     */
+    bool find(std::uint64_t h, const int *list, double &fitness, int *result = nullptr) {
+        shard &s = shard_for(h);
+        std::lock_guard<std::mutex> guard(s.lock);
+        for (int probe = 0; probe < max_probes; ++probe) {
+            std::size_t i = (h + probe) & (shard_capacity - 1);
+            if (s.hashes[i] == 0) return false;
+            if (s.hashes[i] == h && std::memcmp(&s.lists[i * number_of_jobs], list, sizeof(int) * number_of_jobs) == 0) {
+                fitness = s.fitness[i];
+                if (store_results && result) std::copy_n(&s.results[i * number_of_jobs], number_of_jobs, result);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Guarda (ou atualiza) o fitness exato de uma lista e, com
+    /// store_results, a lista resultante (nullptr = a própria lista). h = 0
+    /// marca posição vazia e é ignorado.
+    void insert(std::uint64_t h, const int *list, double fitness, const int *result = nullptr) {
+        if (h == 0) return;
+        shard &s = shard_for(h);
+        std::lock_guard<std::mutex> guard(s.lock);
+
+        std::size_t target = h & (shard_capacity - 1);
+        for (int probe = 0; probe < max_probes; ++probe) {
+            std::size_t i = (h + probe) & (shard_capacity - 1);
+            if (s.hashes[i] == 0 ||
+                (s.hashes[i] == h && std::memcmp(&s.lists[i * number_of_jobs], list, sizeof(int) * number_of_jobs) == 0)) {
+                target = i;
+                break;
+            }
+        }
+        s.hashes[target] = h;
+        s.fitness[target] = fitness;
+        std::copy_n(list, number_of_jobs, &s.lists[target * number_of_jobs]);
+        if (store_results) std::copy_n(result ? result : list, number_of_jobs, &s.results[target * number_of_jobs]);
+    }
+
+    private:
+    shard &shard_for(std::uint64_t h) { return shards[h >> 60]; }
+};
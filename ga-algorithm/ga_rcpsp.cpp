@@ -2,27 +2,49 @@
 #include <iostream>
 #include <iterator>
 #include <limits>
-#include <map>
 #include <tuple>
 #include <random>
-#include <cctype>
 #include <sstream>
+#include <cctype>
 #include <string>
 #include <vector>
 #include <unordered_set>
 #include <algorithm>
 #include <climits>
+#include <cstdint>
+#include <cstring>
 #include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <iomanip>
+#include <numeric>
+#include <queue>
+#include <atomic>
+#include <functional>
+
+#include "arc_set.hpp"
+#include "compact_instance.hpp"
+#include "cyclic_pattern.hpp"
+#include "fitness_cache.hpp"
+#include "graph_preprocessing.hpp"
+#include "instance_cache.hpp"
+#include "lower_bounds.hpp"
+#include "mapped_file.hpp"
+#include "patient_symmetry.hpp"
+#include "population.hpp"
+#include "regret_sampler.hpp"
+#include "resource_profile.hpp"
+#include "text_scanner.hpp"
+#include "thread_pool.hpp"
 
 using namespace std;
 namespace fs = std::filesystem;
 
 /**
  * @brief Representa uma tarefa (job) no projeto RCPSP.
- * * Esta estrutura armazena todas as informações estáticas (grafo, recursos)
- * e dinâmicas (tempos calculados, estados) de uma única atividade.
+ * * Esta estrutura armazena apenas as informações estáticas da instância
+ * (grafo, recursos) e os tempos do caminho crítico, que também são fixos após a
+ * leitura. O estado de uma decodificação fica em evaluation_context.
  */
 struct node
 {
@@ -33,8 +55,6 @@ struct node
     vector<int> successors;
     vector<int> renewable_resource_requirements;
 
-    int start_time;
-    int finish_time;
     int duration_time;
 
     // for calculate critic path (CPM)
@@ -43,40 +63,144 @@ struct node
     int earliest_finish;
     int latest_finish;
 
-    // --- Atributos do Algoritmo Genético ---
-    double priority_value;
-    double selection_probability;
-
-    bool started;
-    bool finished;
-    bool scheduled;
-
     /**
      * @brief Construtor padrão.
-     * Inicializa os IDs e tempos com -1 (indicando "não definido") e flags como
-     * false.
+     * Inicializa os IDs e tempos com -1 (indicando "não definido").
      */
     node() {
         id = -1;
 
-        start_time = -1;
-        finish_time = -1;
         duration_time = 0;
 
         earliest_start = -1;
         latest_start = -1;
         earliest_finish = -1;
         latest_finish = -1;
+    }
+};
+
+/**
+ * @brief Estado mutável de uma decodificação (SGS).
+ * * Os decodificadores são const em relação ao project e escrevem apenas aqui,
+ * então cada thread precisa do seu próprio contexto. Os vetores são
+ * reaproveitados entre avaliações para evitar realocações no laço do GA.
+ */
+struct evaluation_context
+{
+    /// Posição de cada tarefa na activity_list (menor = mais prioritária).
+    vector<int> priority_value;
+
+    /// Cronograma resultante: tempos de início e término por ID (-1 = não agendada).
+    vector<int> start_time;
+    vector<int> finish_time;
+    vector<char> scheduled;
+
+    resource_profile profile;
+
+    // --- Buffers de trabalho dos SGS ---
+    vector<int> eligibles;
+    vector<int> active_jobs;
+    vector<int> resource_profile_changes;
+    vector<int> remaining_predecessors;
+    vector<int> released;
+    vector<int> ready_per_class;
+    vector<unsigned int> rejected_stamp;
+    /// Por classe, quantas atividades em execução são disjuntivas com ela.
+    vector<int> running_conflicts;
+    vector<pair<int, int>> finish_events;
+
+    /// Buffer da canonização da lista (project::canonicalize_slot).
+    vector<int> canonical_order;
+    /// Lista de entrada da avaliação (chave do cache quando a canonização a
+    /// reescreve) ou, num acerto, a lista final guardada.
+    vector<int> cache_key_list;
+    /// Renumeração de pacientes da última quebra de simetria (patient_symmetry::relabel).
+    vector<int> symmetry_target;
+
+    /// Buffers do forward-backward improvement: ordem das passadas e o
+    /// cronograma de entrada, restaurado se a justificação não melhorar.
+    vector<int> justification_order;
+    vector<int> original_start;
+    vector<int> original_finish;
+
+    // --- Corte antecipado (ver project::evaluate) ---
+
+    /// A decodificação é abandonada quando o limitante inferior do makespan
+    /// passa deste valor (INT_MAX = sem corte).
+    int cutoff = INT_MAX;
+    /// Maior (término + cauda crítica) entre as tarefas já agendadas.
+    int makespan_bound = 0;
+
+    /// Contadores acumulados entre chamadas (zerados por quem os lê).
+    long long decodes = 0;
+    long long rejected_decodes = 0;
+    long long skipped_activities = 0;
+    long long cache_lookups = 0;
+    long long cache_hits = 0;
+    /// Tempo gasto nas decodificações (medido só com o cache de fitness ativo).
+    long long decode_ns = 0;
+    /// Cronogramas justificados pelo FBI, quantos melhoraram e a soma das reduções.
+    long long justifications = 0;
+    long long justification_improvements = 0;
+    long long justification_gain = 0;
+
+    /**
+     * @brief Prepara o contexto para decodificar uma activity_list.
+     * Preenche o mapa de prioridades e limpa o cronograma anterior.
+     */
+    void reset(const int *activity_list, int number_of_jobs,
+               const vector<int> &renewable_resource_availability) {
+        priority_value.assign(number_of_jobs, number_of_jobs + 1);
+        for (int i = 0; i < number_of_jobs; ++i) {
+            priority_value[activity_list[i]] = (int)i;
+        }
 
-        priority_value = 0.0;
-        selection_probability = 0.0;
+        start_time.assign(number_of_jobs, -1);
+        finish_time.assign(number_of_jobs, -1);
+        scheduled.assign(number_of_jobs, false);
 
-        started = false;
-        finished = false;
-        scheduled = false;
+        profile.reset(renewable_resource_availability);
+
+        eligibles.clear();
+        active_jobs.clear();
+        resource_profile_changes.clear();
+        released.clear();
+        finish_events.clear();
+        makespan_bound = 0;
     }
 };
 
+/**
+ * @brief Verifica se uma lista de atividades (ponteiro + tamanho) respeita as
+ * precedências: nenhum sucessor aparece antes de um predecessor.
+ * @param position_in_list Buffer de trabalho reaproveitado entre chamadas.
+ */
+bool is_precedence_feasible(const int *activity_list, size_t length, const vector<node> &all_nodes,
+                            vector<int> &position_in_list) {
+    position_in_list.assign(all_nodes.size(), -1);
+
+    for (size_t i = 0; i < length; ++i) {
+        position_in_list[activity_list[i]] = i;
+    }
+
+    for (size_t i = 0; i < length; ++i) {
+        int node_id = activity_list[i];
+        int current_position = position_in_list[node_id];
+
+        const node &current_node = all_nodes[node_id];
+
+        for (int predecessor_id : current_node.predecessors) {
+            if (position_in_list[predecessor_id] != -1) {
+                if (position_in_list[predecessor_id] > current_position) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
 /**
  * @brief Representa um Indivíduo (Cromossomo) na população do Algoritmo
  * Genético.
@@ -90,10 +214,9 @@ struct individual
 
     vector<int> activity_list;
 
-    /// Mapa {ID da Tarefa -> Tempo de Início}. Representa quando cada tarefa
-    /// começa nesta solução.
-    map<int, int> start_times;
-    map<int, int> finish_times;
+    /// Tempo de início de cada tarefa nesta solução, indexado pelo ID da tarefa.
+    vector<int> start_times;
+    vector<int> finish_times;
 
     /**
      * @brief Construtor padrão.
@@ -111,34 +234,290 @@ struct individual
      * @return true Se a lista for viável (topologicamente ordenada).
      * @return false Se houver violação de precedência.
      */
-    bool check_precedence_feasibility(vector<node> &all_nodes) {
-        vector<int> position_in_list(all_nodes.size(), -1);
+    bool check_precedence_feasibility(const vector<node> &all_nodes) const {
+        vector<int> position_in_list;
+        return is_precedence_feasible(activity_list.data(), activity_list.size(), all_nodes, position_in_list);
+    }
+
+    void restore_precedence_of_activity_list() {}
+};
+
+/// @brief Operador de crossover usado pelo GA.
+enum class crossover_operator { one_point, two_point };
+
+/// @brief Operador de mutação usado pelo GA.
+enum class mutation_operator { adjacent_swap, shift };
+
+/// @brief Topologia de migração do modelo de ilhas.
+enum class migration_topology { ring, fully_connected };
+
+/**
+ * @brief Parâmetros do modelo de ilhas (solve_instance_via_islands).
+ */
+struct island_options
+{
+    int islands = 4;
+    /// Gerações entre duas migrações.
+    int migration_interval = 5;
+    /// Quantos dos melhores indivíduos cada ilha envia a cada migração.
+    int migrants = 2;
+    migration_topology topology = migration_topology::ring;
+};
+
+/// @brief Como terminou uma decodificação interrompível.
+enum class decode_status { complete, infeasible, rejected };
+
+/// @brief Fitness de um filho cuja decodificação foi abandonada pelo corte
+/// antecipado: fica atrás de qualquer membro na redução.
+const double rejected_fitness = numeric_limits<double>::infinity();
+
+struct project;
+
+/// @brief Critério que encerrou um solve.
+enum class stop_reason { generations, time_limit, evaluations, target, stall, lower_bound, converged, pattern };
+
+/// @brief Nome curto do critério de parada (log e CSV).
+inline const char *stop_reason_name(stop_reason reason) {
+    switch (reason) {
+        case stop_reason::generations: return "geracoes";
+        case stop_reason::time_limit: return "tempo";
+        case stop_reason::evaluations: return "avaliacoes";
+        case stop_reason::target: return "alvo";
+        case stop_reason::stall: return "estagnacao";
+        case stop_reason::lower_bound: return "otimo";
+        case stop_reason::converged: return "convergencia";
+        case stop_reason::pattern: return "padrao";
+    }
+    return "?";
+}
+
+/**
+ * @brief Quando aplicar o forward-backward improvement (project::
+ * forward_backward_improvement) durante o solve.
+ */
+enum class justification_mode
+{
+    off,
+    /// Todo cronograma decodificado (população inicial e filhos).
+    offspring,
+    /// Só os melhores membros, uma vez cada, antes de cada redução.
+    elites,
+    /// Cada cronograma decodificado com probabilidade justification_probability.
+    probability
+};
+
+/// @brief Dados passados ao callback a cada melhora do incumbente.
+struct incumbent_update
+{
+    double fitness;
+    /// Tempo desde o início do solve (inclui a população inicial).
+    double elapsed_ms;
+    /// Geração em que a melhora apareceu (0 = população inicial).
+    int generation;
+    /// Avaliações de cronograma feitas até aqui.
+    long long evaluations;
+};
+
+/**
+ * @brief Stream que descarta tudo o que recebe (solve_options::log = nullptr).
+ * Um por thread: escrever num stream sem buffer altera o seu estado.
+ */
+inline ostream &discarded_log() {
+    thread_local ostream discard(nullptr);
+    return discard;
+}
+
+/**
+ * @brief Parâmetros de project::solve.
+ * * Os critérios de parada podem ser combinados livremente; o solve para no
+ * primeiro que for atingido. 0 desliga o critério; max_generations < 0 tira
+ * o limite de gerações (e exige algum outro critério). A população inicial
+ * (de todas as ilhas) é sempre avaliada por inteiro e entra na contagem de
+ * avaliações: o orçamento só corta os filhos das gerações, então com
+ * max_evaluations menor que a população inicial o solve passa do orçamento.
+ * O limite de tempo poupa o primeiro membro, para que sempre exista um
+ * incumbente.
+ */
+struct solve_options
+{
+    int pop_size = 40;
+    double mutation_probability = 0.05;
+    /// Decodificador (nullptr = parallel SGS).
+    double (project::*sgs)(const int *, evaluation_context &) const = nullptr;
+    /// Modelo de ilhas quando islands.islands > 1.
+    island_options islands = {1, 5, 2, migration_topology::ring};
+
+    // --- Critérios de parada ---
+
+    /// Gerações completas (0 = só a população inicial; < 0 = sem limite).
+    int max_generations = 25;
+    /// Tempo de parede em ms. Verificado antes de cada avaliação: o solve pode
+    /// passar do limite em no máximo uma decodificação por thread.
+    double time_limit_ms = 0;
+    /// Avaliações de cronograma. A população inicial conta, mas é avaliada
+    /// inteira mesmo que passe do orçamento; os filhos param nele.
+    long long max_evaluations = 0;
+    /// Para quando o incumbente tiver makespan <= target_makespan.
+    double target_makespan = 0;
+    /// Gerações seguidas sem melhora do incumbente.
+    int stall_generations = 0;
+    /// Para quando a população (todas as ilhas) tiver no máximo este número
+    /// de cronogramas distintos. Só vale com project::canonicalize.
+    int converged_diversity = 0;
+
+    // --- Forward-backward improvement ---
+
+    justification_mode justification = justification_mode::off;
+    /// Chance de cada cronograma ser justificado (modo probability).
+    double justification_probability = 0.2;
+    /// Quantos dos melhores membros são justificados por geração (modo elites).
+    int justified_elites = 4;
+
+    /// Chamado na thread principal sempre que o incumbente melhora.
+    function<void(const incumbent_update &)> on_improvement;
+
+    /// Destino do log do solve (limitantes, gerações, resumo; nullptr = silencioso).
+    ostream *log = &cout;
+
+    ostream &log_stream() const { return log ? *log : discarded_log(); }
+};
+
+/// @brief Estatísticas de um solve.
+struct solve_statistics
+{
+    stop_reason reason = stop_reason::generations;
+    int generations = 0;
+    long long evaluations = 0;
+    /// Avaliações abandonadas pelo corte antecipado e atividades que elas pularam.
+    long long aborted_evaluations = 0;
+    long long skipped_activities = 0;
+    /// Consultas e acertos do cache de fitness e o tempo de decodificação que
+    /// os acertos pouparam (estimado pelo tempo médio das decodificações).
+    long long cache_lookups = 0;
+    long long cache_hits = 0;
+    double cache_saved_ms = 0.0;
+    /// Cronogramas que passaram pelo FBI e quantos deles ficaram mais curtos.
+    long long justifications = 0;
+    long long justification_improvements = 0;
+    int improvements = 0;
+    /// Cronogramas distintos na população ao final (0 = não medido, sem
+    /// canonização; com ilhas, a soma das ilhas).
+    int diversity = 0;
+    double elapsed_ms = 0.0;
+    double initialization_ms = 0.0;
+    /// Quando (e em que geração) o melhor indivíduo apareceu.
+    double best_found_ms = 0.0;
+    int best_generation = 0;
+};
+
+struct solve_result
+{
+    individual best;
+    solve_statistics statistics;
+};
+
+/// @brief Parâmetros de project::solve_by_pattern.
+struct pattern_options
+{
+    /// Maior bloco testado (pacientes por padrão).
+    int max_patients_per_pattern = 8;
+    /// Avaliações do GA em cada bloco, por decodificador.
+    long long evaluations_per_pattern = 1000;
+};
 
-        for (size_t i = 0; i < activity_list.size(); ++i) {
-            position_in_list[activity_list[i]] = i;
+/// @brief Cronograma construído por project::solve_by_pattern e o padrão usado.
+struct pattern_result
+{
+    /// Fitness infinito se a instância não tem pacientes idênticos.
+    individual best;
+    int patients_per_pattern = 0;
+    /// Deslocamento entre cópias do bloco e o makespan do bloco sozinho.
+    int period = 0;
+    int pattern_makespan = 0;
+    /// Pacientes do grupo ladrilhado (os demais entram um a um).
+    int tiled_patients = 0;
+    /// Avaliações dos GAs dos blocos.
+    long long evaluations = 0;
+    double search_ms = 0.0;
+    double elapsed_ms = 0.0;
+};
+
+/**
+ * @brief Acompanha os critérios de parada de um solve e dispara o callback
+ * de melhora. Só é usado na thread principal, exceto expired(), que as
+ * threads de avaliação consultam antes de cada decodificação.
+ */
+struct solve_monitor
+{
+    using clock = chrono::steady_clock;
+
+    const solve_options &options;
+    solve_statistics &statistics;
+    clock::time_point start;
+    /// time_point::max() quando não há limite de tempo.
+    clock::time_point deadline;
+    int last_improvement = 0;
+    /// Cronogramas distintos na última geração (ver converged_diversity).
+    int diversity = INT_MAX;
+
+    solve_monitor(const solve_options &opts, solve_statistics &stats)
+        : options(opts), statistics(stats), start(clock::now()), deadline(clock::time_point::max()) {
+        if (options.time_limit_ms > 0) {
+            deadline = start + chrono::duration_cast<clock::duration>(
+                                   chrono::duration<double, milli>(options.time_limit_ms));
         }
+    }
 
-        for (int node_id : activity_list) {
-            int current_position = position_in_list[node_id];
+    double elapsed_ms() const { return chrono::duration<double, milli>(clock::now() - start).count(); }
 
-            const node &current_node = all_nodes[node_id];
+    bool expired() const { return deadline != clock::time_point::max() && clock::now() >= deadline; }
 
-            for (int predecessor_id : current_node.predecessors) {
-                if (position_in_list[predecessor_id] != -1) {
-                    if (position_in_list[predecessor_id] > current_position) {
-                        return false;
-                    }
-                }
-            }
+    /// @brief Quantas de 'wanted' avaliações ainda cabem no orçamento.
+    long long evaluation_allowance(long long wanted) const {
+        if (options.max_evaluations <= 0) return wanted;
+        return max(0LL, min(wanted, options.max_evaluations - statistics.evaluations));
+    }
+
+    /// @brief Registra um incumbente novo e chama o callback.
+    void improved(double fitness, int generation) {
+        statistics.improvements++;
+        statistics.best_found_ms = elapsed_ms();
+        statistics.best_generation = generation;
+        last_improvement = generation;
+        if (options.on_improvement) {
+            options.on_improvement({fitness, statistics.best_found_ms, generation, statistics.evaluations});
         }
+    }
 
+    /**
+     * @brief Verifica os critérios de parada antes da geração 'generation'
+     * (gerações já completas). Preenche statistics.reason.
+     * @param lower_bound Melhor limitante inferior (0 = desconhecido).
+     */
+    bool should_stop(double incumbent, double lower_bound, int generation) {
+        stop_reason reason;
+        if (lower_bound > 0 && incumbent == lower_bound) reason = stop_reason::lower_bound;
+        else if (options.target_makespan > 0 && incumbent <= options.target_makespan) reason = stop_reason::target;
+        else if (expired()) reason = stop_reason::time_limit;
+        else if (options.max_evaluations > 0 && statistics.evaluations >= options.max_evaluations)
+            reason = stop_reason::evaluations;
+        else if (options.stall_generations > 0 && generation - last_improvement >= options.stall_generations)
+            reason = stop_reason::stall;
+        else if (options.converged_diversity > 0 && diversity <= options.converged_diversity)
+            reason = stop_reason::converged;
+        else if (options.max_generations >= 0 && generation >= options.max_generations)
+            reason = stop_reason::generations;
+        else return false;
+
+        statistics.reason = reason;
         return true;
     }
-
-    void restore_precedence_of_activity_list() {}
 };
 
 struct project {
+    /// @brief Assinatura dos decodificadores: (activity_list, contexto) -> makespan.
+    using sgs_function = double (project::*)(const int *, evaluation_context &) const;
+
     /// @brief gerador de número aleatório (Mersene Twistter)
     mt19937 rng;
 
@@ -149,33 +528,171 @@ struct project {
     int horizon;
     int cpm_lower_bound;
 
+    /// @brief ES/EF/LS/LF já calculados (pelo CPM ou lidos do cache binário)
+    bool cpm_computed;
+
+    /// @brief limitantes inferiores do makespan (ver compute_bounds); o GA para
+    /// assim que o incumbente atinge bounds.best()
+    lower_bounds bounds;
+    bool bounds_computed;
+
+    /// @brief tempo gasto gerando a população inicial na última execução (ms),
+    /// medido à parte do laço do GA
+    double initialization_time_ms;
+
     vector<int> renewable_resource_availability;
-    vector<individual> population;
+    population_storage population;
 
     vector<node> nodes;
 
+    /// @brief operador de crossover (um ponto, como no artigo, ou dois pontos)
+    crossover_operator crossover_type;
+
+    /// @brief operador de mutação (troca adjacente, como no artigo, ou deslocamento)
+    mutation_operator mutation_type;
+
+    /// @brief posições entre checkpoints do serial SGS (0 desativa, -1 = n / 8)
+    int checkpoint_interval;
+
+    /// @brief arcos de precedência diretos, para consultas O(1) na mutação
+    arc_set precedence_arcs;
+
+    /// @brief número de predecessores de cada tarefa (contadores iniciais do parallel SGS)
+    vector<int> number_of_predecessors;
+
+    /// @brief maior soma de durações de um caminho da origem até o início de
+    /// cada tarefa
+    vector<int> critical_head;
+
+    /// @brief maior soma de durações de um caminho que sai do término de cada
+    /// tarefa até o fim do projeto (limitante do corte antecipado)
+    vector<int> critical_tail;
+
+    /// @brief abandona a decodificação de filhos que já não podem entrar na população
+    bool early_abort;
+
+    /// @brief reescreve cada lista avaliada na ordem dos inícios do cronograma
+    /// (ver canonicalize_slot) e descarta duplicatas na redução
+    bool canonicalize;
+
+    /// @brief renumera os pacientes idênticos de cada lista avaliada pela
+    /// ordem de aparição (ver break_symmetry_slot)
+    bool break_symmetry;
+
+    /// @brief grupos de pacientes idênticos da instância
+    patient_symmetry symmetry;
+
+    /// @brief posição de cada tarefa numa ordem topológica fixa (desempate da
+    /// canonização; igual ao id quando a numeração já é topológica)
+    vector<int> topological_rank;
+
+    /// @brief tamanho do cache de fitness em listas (0 = desligado); o cache é
+    /// limpo a cada solve
+    int fitness_cache_size;
+    mutable fitness_cache cache;
+
+    /// @brief decodificador do solve corrente (materializa cronogramas que
+    /// vieram do cache de fitness)
+    sgs_function active_sgs;
+
+    /// @brief classe de cada tarefa: tarefas com a mesma duração e as mesmas
+    /// demandas compartilham a classe (as instâncias multi-paciente têm poucas)
+    vector<int> job_class;
+
+    /// @brief para cada classe c, as classes com duração e demandas >= às de c
+    /// (incluindo c): se c não cabe num instante, nenhuma delas cabe
+    vector<vector<int>> dominated_classes;
+
+    /// @brief demandas de todas as tarefas numa tabela contígua, K inteiros
+    /// por tarefa (evita seguir o ponteiro de cada node nos decodificadores)
+    vector<int> request_rows;
+
+    /// @brief grafo em CSR, durações e demandas estreitas e tempos do CPM em
+    /// vetores separados: o que os decodificadores leem da instância. O grafo
+    /// é a redução transitiva do lido (node guarda os arcos originais)
+    compact_instance compact;
+
+    /// @brief pares de classes (job_class) que nunca executam juntas
+    graph_preprocessing::disjunctive_pairs disjunctive_classes;
+
+    /// @brief arcos removidos, pares disjuntivos e tempos do pré-processamento
+    graph_preprocessing::report preprocessing;
+
+    /**
+     * @brief Versões dos decodificadores usadas por parallel_SGS e
+     * serial_SGS_positions: especializadas para o número de recursos da
+     * instância (1 a 8) ou a dinâmica.
+     */
+    struct decoder_family
+    {
+        double (project::*parallel)(const int *, evaluation_context &) const;
+        decode_status (project::*serial_positions)(const int *, int, int, evaluation_context &, int &, bool) const;
+        /// Recursos fixos em tempo de compilação (0 = dinâmica).
+        int resources;
+    };
+    decoder_family decoders;
+
+    /// @brief contexto de avaliação reaproveitado pelo laço sequencial do GA
+    evaluation_context context;
+
+    /// @brief threads de avaliação e um contexto de trabalho por thread
+    thread_pool pool;
+    vector<evaluation_context> worker_contexts;
+
     project() {
         random_device rd;
         rng = mt19937(rd());
         cpm_lower_bound = 0;
+        cpm_computed = false;
+        bounds_computed = false;
+        initialization_time_ms = 0.0;
+        crossover_type = crossover_operator::one_point;
+        mutation_type = mutation_operator::adjacent_swap;
+        checkpoint_interval = -1;
+        early_abort = true;
+        canonicalize = false;
+        break_symmetry = false;
+        fitness_cache_size = 4096;
+        active_sgs = &project::parallel_SGS;
+        decoders = decoder_family_for<0>();
+    }
+
+    /**
+     * @brief Fixa a semente do gerador. Com a mesma semente, o GA produz o mesmo
+     * resultado independentemente do número de threads de avaliação.
+     */
+    void set_seed(unsigned int seed) {
+        rng.seed(seed);
+    }
+
+    /// @brief Define quantas threads avaliam a população (1 = sequencial).
+    void set_threads(int number_of_threads) {
+        pool.resize(number_of_threads);
     }
 
     void clear() {
         nodes.clear();
         renewable_resource_availability.clear();
-        population.clear();
+        compact = compact_instance();
+        population = population_storage();
         number_of_jobs = 0;
+        number_of_nondummy_jobs = 0;
+        number_of_renewable_resources = 0;
         horizon = 0;
         cpm_lower_bound = 0;
+        cpm_computed = false;
+        bounds = lower_bounds();
+        bounds_computed = false;
     }
 
     /**
      * @brief Calcula o Caminho Crítico (CPM).
      * Preenche ES, EF, LS, LF de todos os nós.
-     * Necessário para o método de amostragem da população inicial.
+     * Necessário para o método de amostragem da população inicial. Não faz
+     * nada se os tempos já vieram do cache binário.
      */
     void forward_backward_scheduling() {
-        if (nodes.empty())
+        if (nodes.empty() || cpm_computed)
             return;
 
         calculate_forward_pass();
@@ -184,646 +701,1551 @@ struct project {
         if (!nodes.empty()) {
             cpm_lower_bound = nodes[number_of_jobs - 1].earliest_finish;
         }
+        cpm_computed = true;
+        store_cpm_times();
+    }
+
+    /**
+     * @brief Caminho do cache binário de uma instância: o mesmo arquivo com
+     * extensão .smc (ex: "folfiri_5_pacientes.smc").
+     */
+    static string cache_path_for(const string &full_path) {
+        return fs::path(full_path).replace_extension(".smc").string();
+    }
+
+    /**
+     * @brief Carrega uma instância, preferindo o cache binário (.smc) quando
+     * ele existe e é mais novo que o .sm. Um cache inválido (versão antiga,
+     * arquivo truncado, valores negativos) é ignorado e o texto é lido normalmente.
+     * @return bool Verdadeiro se a instância veio do cache.
+     */
+    bool load_project(const string &full_path) {
+        string cache_path = cache_path_for(full_path);
+        error_code ec;
+        auto source_time = fs::last_write_time(full_path, ec);
+        if (!ec) {
+            auto cache_time = fs::last_write_time(cache_path, ec);
+            if (!ec && cache_time > source_time) {
+                string error;
+                if (read_project_cache(cache_path, &error)) return true;
+                cerr << "Aviso: cache inválido ou de outra versão" << (error.empty() ? "" : " (" + error + ")")
+                     << ", lendo " << full_path << endl;
+            }
+        }
+
+        read_project(full_path);
+        return false;
     }
 
     /**
      * @brief Lê e analisa um arquivo de instância (formato PSPLIB .sm).
-     * * Esta função carrega o arquivo inteiro na memória, identifica seções por
-     * palavras-chave
-     * ("projects", "PRECEDENCE RELATIONS", etc.) e preenche os vetores de nós e
-     * recursos.
-     * * @param instance_filepath Caminho do diretório onde o arquivo está.
-     * @param instance_name Nome do arquivo (ex: "j1201_1.sm").
+     * * O arquivo é mapeado em memória e analisado por parse_project, sem
+     * cópias por linha. Em caso de erro a mensagem (com o número da linha) vai
+     * para cerr e o projeto fica vazio (number_of_jobs == 0).
+     * * @param full_path Caminho completo do arquivo (ex: "Instances/j1201_1.sm").
      */
     void read_project(string full_path) {
         clear();
-        vector<string> file_lines = load_file_in_memory(full_path);
-        if (file_lines.empty()) return;
+        mapped_file file(full_path);
+        if (!file.is_open()) {
+            cerr << "Erro: Não foi possível abrir o arquivo " << full_path << endl;
+            return;
+        }
 
-        for (size_t line_index = 0; line_index < file_lines.size(); ++line_index) {
-            string current_line = file_lines[line_index];
+        string error = parse_project(file.data(), file.size());
+        if (!error.empty()) {
+            cerr << "Erro: " << full_path << ": " << error << endl;
+            clear();
+            return;
+        }
 
-            if (current_line.find("jobs (incl. supersource/sink )") != string::npos) {
-                stringstream ss_jobs(current_line);
-                string temp; int val;
-                while (ss_jobs >> temp) { if (stringstream(temp) >> val) number_of_jobs = val; }
-                number_of_nondummy_jobs = number_of_jobs - 2;
+        build_precedence_index();
+    }
 
-                if (line_index + 1 < file_lines.size()) {
-                    stringstream ss_hor(file_lines[line_index + 1]);
-                    while (ss_hor >> temp) { if (stringstream(temp) >> val) horizon = val; }
-                }
-                if (line_index + 2 < file_lines.size()) {
-                    stringstream ss_res(file_lines[line_index + 2]);
-                    vector<int> numbers;
-                    while (ss_res >> temp) { if (stringstream(temp) >> val) numbers.push_back(val); }
-                    if (!numbers.empty()) number_of_renewable_resources = numbers.back();
-                }
-                nodes.resize(number_of_jobs);
+    /// @brief Mensagens de valores inválidos, comuns a parse_project e
+    /// read_project_cache (job numerado a partir de 1, como no .sm).
+    static string negative_duration_error(int job) { return "duração negativa na atividade " + to_string(job); }
+    static string negative_request_error(int job) { return "demanda negativa na atividade " + to_string(job); }
+    static string negative_availability_error() { return "disponibilidade negativa"; }
+
+    /**
+     * @brief Analisa o texto de uma instância .sm numa única passada.
+     * * As seções são reconhecidas pelo cabeçalho no início da linha
+     * ("jobs (incl. supersource/sink )", "horizon", "renewable resources" ou
+     * "- renewable", "PRECEDENCE RELATIONS:", "REQUESTS/DURATIONS:",
+     * "RESOURCEAVAILABILITIES:"); as demais linhas (comentários '*', linhas de
+     * rótulo) são ignoradas. As linhas de cada tabela são atribuídas pelo
+     * jobnr, e sucessores, predecessores e demandas são preenchidos enquanto o
+     * texto é lido.
+     * * Atividades sem linha em REQUESTS/DURATIONS ficam com duração e demanda
+     * zero (as instâncias geradas omitem algumas).
+     * @return string Vazia se a leitura deu certo; senão, a mensagem de erro.
+     */
+    string parse_project(const char *data, size_t size) {
+        text_scanner in(data, size);
+        auto error_at = [&](const string &message) { return "linha " + to_string(in.line) + ": " + message; };
+        auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+
+        bool has_precedences = false, has_requests = false, has_availabilities = false;
+
+        // Pula a linha de rótulo que segue um cabeçalho de seção, se houver.
+        auto skip_label_line = [&]() {
+            in.next_line();
+            char c = in.peek();
+            if (c != '\0' && !is_digit(c)) in.next_line();
+        };
+
+        while (!in.at_end()) {
+            if (in.consume("jobs (incl. supersource/sink )")) {
+                if (!in.skip_past(':') || !in.read_int(number_of_jobs) || number_of_jobs < 2)
+                    return error_at("número de atividades inválido");
+                number_of_nondummy_jobs = number_of_jobs - 2;
+                nodes.assign(number_of_jobs, node());
                 for (int i = 0; i < number_of_jobs; ++i) nodes[i].id = i;
+                in.next_line();
+            }
+            else if (in.consume("horizon")) {
+                if (!in.skip_past(':') || !in.read_int(horizon)) return error_at("horizonte inválido");
+                in.next_line();
             }
-            else if (current_line.find("PRECEDENCE RELATIONS:") != string::npos) {
-                size_t starting_line_index = line_index + 2;
-                for (int i = 0; i < number_of_jobs; ++i) {
-                    if (starting_line_index + i >= file_lines.size()) break;
-                    stringstream ss(file_lines[starting_line_index + i]);
-                    int job_idx, mode, num_successors;
-                    ss >> job_idx >> mode >> num_successors;
-                    for (int j = 0; j < num_successors; ++j) {
-                        int succ_id; ss >> succ_id;
-                        nodes[i].successors.push_back(succ_id - 1);
+            else if (in.consume("renewable resources") || in.consume("- renewable")) {
+                if (!in.skip_past(':') || !in.read_int(number_of_renewable_resources) ||
+                    number_of_renewable_resources < 0)
+                    return error_at("número de recursos renováveis inválido");
+                in.next_line();
+            }
+            else if (in.consume("PRECEDENCE RELATIONS:")) {
+                if (nodes.empty()) return error_at("PRECEDENCE RELATIONS antes do número de atividades");
+                vector<char> seen(number_of_jobs, 0);
+
+                for (skip_label_line(); is_digit(in.peek()); in.next_line()) {
+                    int job, mode, number_of_successors;
+                    if (!in.read_int(job) || !in.read_int(mode) || !in.read_int(number_of_successors) ||
+                        number_of_successors < 0)
+                        return error_at("linha de precedência incompleta");
+                    if (job < 1 || job > number_of_jobs) return error_at("atividade inexistente " + to_string(job));
+                    if (seen[job - 1]++) return error_at("atividade repetida " + to_string(job));
+
+                    for (int j = 0; j < number_of_successors; ++j) {
+                        int succ_id;
+                        if (!in.read_int(succ_id)) return error_at("faltam sucessores da atividade " + to_string(job));
+                        if (succ_id < 1 || succ_id > number_of_jobs)
+                            return error_at("sucessor inexistente " + to_string(succ_id));
+                        nodes[job - 1].successors.push_back(succ_id - 1);
+                        nodes[succ_id - 1].predecessors.push_back(job - 1);
                     }
+                    if (!in.at_line_end()) return error_at("sucessores além dos declarados na atividade " + to_string(job));
                 }
-                for (int i = 0; i < number_of_jobs; ++i) {
-                    for (int succ_id : nodes[i].successors) nodes[succ_id].predecessors.push_back(i);
-                }
+                has_precedences = true;
             }
-            else if (current_line.find("REQUESTS/DURATIONS:") != string::npos) {
-                size_t starting_line_index = line_index + 2;
-                for (int i = 0; i < number_of_jobs; ++i) {
-                    if (starting_line_index + i >= file_lines.size()) break;
-                    stringstream ss(file_lines[starting_line_index + i]);
-                    int job_idx, mode, duration;
-                    ss >> job_idx >> mode >> duration;
-                    nodes[i].duration_time = duration;
-                    int req;
+            else if (in.consume("REQUESTS/DURATIONS:")) {
+                if (nodes.empty()) return error_at("REQUESTS/DURATIONS antes do número de atividades");
+                vector<char> seen(number_of_jobs, 0);
+                for (auto &nd : nodes) nd.renewable_resource_requirements.assign(number_of_renewable_resources, 0);
+
+                for (skip_label_line(); is_digit(in.peek()); in.next_line()) {
+                    int job, mode, duration;
+                    if (!in.read_int(job) || !in.read_int(mode) || !in.read_int(duration))
+                        return error_at("linha de demanda incompleta");
+                    if (job < 1 || job > number_of_jobs) return error_at("atividade inexistente " + to_string(job));
+                    if (seen[job - 1]++) return error_at("atividade repetida " + to_string(job));
+                    if (duration < 0) return error_at(negative_duration_error(job));
+
+                    node &nd = nodes[job - 1];
+                    nd.duration_time = duration;
                     for (int k = 0; k < number_of_renewable_resources; ++k) {
-                        if (ss >> req) nodes[i].renewable_resource_requirements.push_back(req);
+                        if (!in.read_int(nd.renewable_resource_requirements[k]))
+                            return error_at("faltam demandas da atividade " + to_string(job));
+                        if (nd.renewable_resource_requirements[k] < 0) return error_at(negative_request_error(job));
                     }
+                    if (!in.at_line_end()) return error_at("demandas além dos recursos declarados na atividade " + to_string(job));
                 }
+                has_requests = true;
             }
-            else if (current_line.find("RESOURCEAVAILABILITIES:") != string::npos) {
-                size_t starting_line_index = line_index + 2;
-                if (starting_line_index < file_lines.size()) {
-                     stringstream ss(file_lines[starting_line_index]);
-                     int avail;
-                     while (ss >> avail) renewable_resource_availability.push_back(avail);
-                     if (renewable_resource_availability.size() > (size_t)number_of_renewable_resources)
-                         renewable_resource_availability.resize(number_of_renewable_resources);
+            else if (in.consume("RESOURCEAVAILABILITIES:")) {
+                skip_label_line();
+                int avail;
+                while (in.read_int(avail)) {
+                    if (avail < 0) return error_at(negative_availability_error());
+                    renewable_resource_availability.push_back(avail);
                 }
+                if (!in.at_line_end() || renewable_resource_availability.size() != (size_t)number_of_renewable_resources)
+                    return error_at("esperadas " + to_string(number_of_renewable_resources) + " disponibilidades");
+                has_availabilities = true;
+                in.next_line();
+            }
+            else {
+                in.next_line();
             }
         }
+
+        if (nodes.empty()) return "número de atividades ausente";
+        if (!has_precedences) return "seção PRECEDENCE RELATIONS ausente";
+        if (!has_requests) return "seção REQUESTS/DURATIONS ausente";
+        if (!has_availabilities) return "seção RESOURCEAVAILABILITIES ausente";
+        return "";
     }
 
     /**
-     * @brief Imprime os detalhes do projeto carregado no console.
-     * Útil para debug e validação do parser.
+     * @brief Grava o cache binário da instância (formato em instance_cache.hpp),
+     * calculando antes o CPM para que o carregamento não precise refazê-lo.
+     * @return bool Falso se o arquivo não pôde ser escrito.
      */
-    void print_project() {
-        if (nodes.empty()) {
-            cout << "O projeto está vazio ou não foi carregado corretamente." << endl;
-            return;
-        }
+    bool write_project_cache(const string &cache_path) {
+        forward_backward_scheduling();
 
-        cout << "==========================================================" << endl;
-        cout << "                PROJECT SUMMARY                           " << endl;
-        cout << "==========================================================" << endl;
-        cout << "Total Jobs (incl. dummy): " << number_of_jobs << endl;
-        cout << "Real Jobs:                " << number_of_nondummy_jobs << endl;
-        cout << "Horizon:                  " << horizon << endl;
-        cout << "Renewable Resources:      " << number_of_renewable_resources << endl;
-        
-        cout << "Resource Availabilities:  [ ";
-        for (int avail : renewable_resource_availability) {
-            cout << avail << " ";
+        instance_cache_header header;
+        memcpy(header.magic, instance_cache_magic, sizeof(header.magic));
+        header.version = instance_cache_version;
+        header.byte_order = instance_cache_byte_order;
+        header.number_of_jobs = number_of_jobs;
+        header.number_of_resources = number_of_renewable_resources;
+        header.horizon = horizon;
+        header.cpm_lower_bound = cpm_lower_bound;
+        header.number_of_arcs = 0;
+        for (const node &nd : nodes) header.number_of_arcs += nd.successors.size();
+
+        vector<int32_t> payload;
+        payload.reserve(header.payload_ints());
+        for (const node &nd : nodes) payload.push_back(nd.duration_time);
+        for (const node &nd : nodes) {
+            payload.insert(payload.end(), nd.renewable_resource_requirements.begin(), nd.renewable_resource_requirements.end());
+        }
+        payload.insert(payload.end(), renewable_resource_availability.begin(), renewable_resource_availability.end());
+
+        auto append_csr = [&](vector<int> node::*adjacency) {
+            int32_t offset = 0;
+            payload.push_back(offset);
+            for (const node &nd : nodes) payload.push_back(offset += (int32_t)(nd.*adjacency).size());
+            for (const node &nd : nodes) payload.insert(payload.end(), (nd.*adjacency).begin(), (nd.*adjacency).end());
+        };
+        append_csr(&node::successors);
+        append_csr(&node::predecessors);
+
+        for (int node::*time : {&node::earliest_start, &node::earliest_finish, &node::latest_start, &node::latest_finish}) {
+            for (const node &nd : nodes) payload.push_back(nd.*time);
         }
-        cout << "]" << endl << endl;
 
-        cout << "----------------------------------------------------------" << endl;
-        cout << " JOB DETAILS (ID | Dur | Res | Succs | Preds)" << endl;
-        cout << "----------------------------------------------------------" << endl;
+        ofstream file(cache_path, ios::binary);
+        if (!file.is_open()) {
+            cerr << "Erro: Não foi possível criar o arquivo " << cache_path << endl;
+            return false;
+        }
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(payload.data()), payload.size() * sizeof(int32_t));
+        return (bool)file;
+    }
 
-        for (const auto& node : nodes) {
-            cout << "Job " << node.id + 1;
-            cout << "\t| Dur: " << node.duration_time;
-            
-            // Requisitos de Recursos
-            cout << "\t| Res: [";
-            for (size_t k = 0; k < node.renewable_resource_requirements.size(); ++k) {
-                cout << node.renewable_resource_requirements[k] << (k < node.renewable_resource_requirements.size() - 1 ? " " : "");
+    /**
+     * @brief Lê um cache binário mapeado em memória: só copia os vetores para
+     * os nós, sem análise de texto nem CPM. Durações, demandas e
+     * disponibilidades são conferidas como em parse_project.
+     * @param error se não nulo, recebe a mensagem quando um valor é inválido
+     * @return bool Falso (projeto vazio) se o arquivo não existe ou é inválido.
+     */
+    bool read_project_cache(const string &cache_path, string *error = nullptr) {
+        clear();
+        mapped_file file(cache_path);
+        if (!file.is_open() || file.size() < sizeof(instance_cache_header)) return false;
+
+        instance_cache_header header;
+        memcpy(&header, file.data(), sizeof(header));
+        if (!header.is_valid(file.size())) return false;
+
+        int n = header.number_of_jobs;
+        int K = header.number_of_resources;
+        const int32_t *cursor = reinterpret_cast<const int32_t *>(file.data() + sizeof(header));
+        auto take = [&](size_t count) {
+            const int32_t *section = cursor;
+            cursor += count;
+            return section;
+        };
+
+        const int32_t *durations = take(n);
+        const int32_t *requests = take((size_t)n * K);
+        const int32_t *availability = take(K);
+        const int32_t *successor_offsets = take(n + 1);
+        const int32_t *successors = take(header.number_of_arcs);
+        const int32_t *predecessor_offsets = take(n + 1);
+        const int32_t *predecessors = take(header.number_of_arcs);
+
+        // Um cache corrompido não pode levar a acessos fora dos vetores.
+        auto is_valid_csr = [&](const int32_t *offsets, const int32_t *ids) {
+            if (offsets[0] != 0 || (uint64_t)offsets[n] != header.number_of_arcs) return false;
+            for (int i = 0; i < n; ++i) {
+                if (offsets[i] > offsets[i + 1]) return false;
             }
-            cout << "]";
-
-            cout << "\t| Succ: {";
-            for (size_t k = 0; k < node.successors.size(); ++k) {
-                cout << node.successors[k] + 1 << (k < node.successors.size() - 1 ? "," : "");
+            for (uint64_t a = 0; a < header.number_of_arcs; ++a) {
+                if (ids[a] < 0 || ids[a] >= n) return false;
             }
-            cout << "}";
-            
-            // Predecessores (Opcional, para verificar lógica inversa)
-            /*
-            cout << "\t| Pred: {";
-            for (size_t k = 0; k < node.predecessors.size(); ++k) {
-                cout << node.predecessors[k] + 1 << (k < node.predecessors.size() - 1 ? "," : "");
+            return true;
+        };
+        if (!is_valid_csr(successor_offsets, successors) || !is_valid_csr(predecessor_offsets, predecessors)) return false;
+
+        string invalid;
+        for (int i = 0; i < n && invalid.empty(); ++i) {
+            if (durations[i] < 0) invalid = negative_duration_error(i + 1);
+            for (int k = 0; k < K && invalid.empty(); ++k) {
+                if (requests[(size_t)i * K + k] < 0) invalid = negative_request_error(i + 1);
             }
-            cout << "}";
-            */
-            
-            cout << endl;
         }
-        cout << "==========================================================" << endl;
-    }
+        for (int k = 0; k < K && invalid.empty(); ++k) {
+            if (availability[k] < 0) invalid = negative_availability_error();
+        }
+        if (!invalid.empty()) {
+            if (error) *error = invalid;
+            return false;
+        }
 
-    /**
-     * @brief Create Initial Population: Cria a população inicial de um determinado tamanho.
-     */
-    vector<individual> create_initial_population(int population_size) {
+        number_of_jobs = n;
+        number_of_nondummy_jobs = n - 2;
+        number_of_renewable_resources = K;
+        horizon = header.horizon;
+        renewable_resource_availability.assign(availability, availability + K);
+
+        nodes.resize(n);
+        for (int i = 0; i < n; ++i) {
+            node &nd = nodes[i];
+            nd.id = i;
+            nd.duration_time = durations[i];
+            nd.renewable_resource_requirements.assign(requests + (size_t)i * K, requests + (size_t)(i + 1) * K);
+            nd.successors.assign(successors + successor_offsets[i], successors + successor_offsets[i + 1]);
+            nd.predecessors.assign(predecessors + predecessor_offsets[i], predecessors + predecessor_offsets[i + 1]);
+        }
+        for (int node::*time : {&node::earliest_start, &node::earliest_finish, &node::latest_start, &node::latest_finish}) {
+            const int32_t *values = take(n);
+            for (int i = 0; i < n; ++i) nodes[i].*time = values[i];
+        }
 
-        forward_backward_scheduling();
+        cpm_lower_bound = header.cpm_lower_bound;
+        cpm_computed = true;
 
-        vector<individual> population;
+        build_precedence_index();
+        return true;
+    }
 
-        individual dummy;
+    /**
+     * @brief Monta em memória uma instância com vários pacientes a partir de uma
+     * instância base de um único paciente (source + atividades + sink), como o
+     * script2 de instances_generator.py: o source liga-se às atividades iniciais
+     * de cada paciente e as atividades finais ligam-se ao sink.
+     * * Usado pelos benchmarks para gerar instâncias de milhares de atividades.
+     */
+    void build_multi_patient_instance(const project &base, int patients) {
+        clear();
 
-        vector<int> nodes_id_sorted_by_min_lft;
-        for (auto &nd : nodes)
-            nodes_id_sorted_by_min_lft.push_back(nd.id);
+        int activities_per_patient = base.number_of_jobs - 2;
+        int base_sink = base.number_of_jobs - 1;
 
-        sort(nodes_id_sorted_by_min_lft.begin(),
-                nodes_id_sorted_by_min_lft.end(),
-                [&](int a, int b){
-                    return nodes[a].latest_finish < nodes[b].latest_finish;
-                });
+        number_of_jobs = activities_per_patient * patients + 2;
+        number_of_nondummy_jobs = number_of_jobs - 2;
+        number_of_renewable_resources = base.number_of_renewable_resources;
+        horizon = base.horizon * patients;
+        renewable_resource_availability = base.renewable_resource_availability;
 
-        dummy.activity_list = nodes_id_sorted_by_min_lft;
-        population.push_back(dummy);
+        nodes.resize(number_of_jobs);
+        for (int i = 0; i < number_of_jobs; ++i) nodes[i].id = i;
 
+        int sink = number_of_jobs - 1;
+        nodes[0].renewable_resource_requirements = base.nodes[0].renewable_resource_requirements;
+        nodes[sink].renewable_resource_requirements = base.nodes[base_sink].renewable_resource_requirements;
 
-        for (int p = 1; p < population_size; p++) {
+        for (int p = 0; p < patients; ++p) {
+            int offset = p * activities_per_patient;
 
-            individual new_dummy;
+            for (int base_id = 1; base_id < base_sink; ++base_id) {
+                node &nd = nodes[offset + base_id];
+                nd.duration_time = base.nodes[base_id].duration_time;
+                nd.renewable_resource_requirements = base.nodes[base_id].renewable_resource_requirements;
 
-            vector<int> unselected_nodes;
-            for (auto &nd : nodes) {
-                unselected_nodes.push_back(nd.id);
+                for (int succ_id : base.nodes[base_id].successors) {
+                    nd.successors.push_back(succ_id == base_sink ? sink : offset + succ_id);
+                }
             }
+            for (int succ_id : base.nodes[0].successors) {
+                nodes[0].successors.push_back(succ_id == base_sink ? sink : offset + succ_id);
+            }
+        }
 
-            vector<int> selected_nodes;
-
-            int starting_node = unselected_nodes[0];
-            selected_nodes.push_back(starting_node);
-            unselected_nodes.erase(unselected_nodes.begin());
-
-            while (!unselected_nodes.empty()) {
-
-                vector<int> possibles;
-
-                // === encontrar possíveis ===
-                for (int node_id : unselected_nodes) {
-
-                    bool all_in_selected = true;
-                    for (int predecessor : nodes[node_id].predecessors) {
+        for (int i = 0; i < number_of_jobs; ++i) {
+            for (int succ_id : nodes[i].successors) nodes[succ_id].predecessors.push_back(i);
+        }
 
-                        if (std::find(selected_nodes.begin(),
-                                    selected_nodes.end(),
-                                    predecessor) == selected_nodes.end()) {
+        build_precedence_index();
+    }
 
-                            all_in_selected = false;
-                            break;
-                        }
-                    }
+    /**
+     * @brief Monta a instância de um único paciente (source + atividades +
+     * sink) com as atividades do membro 'member' de instance.symmetry, na
+     * ordem local: o inverso de build_multi_patient_instance.
+     */
+    void build_patient_instance(const project &instance, int member) {
+        clear();
 
-                    if (all_in_selected)
-                        possibles.push_back(node_id);
-                }
+        const patient_symmetry &groups = instance.symmetry;
+        int first = groups.member_offset[member];
+        int activities = groups.member_offset[member + 1] - first;
+        int instance_sink = instance.number_of_jobs - 1;
 
-                // === calcular probabilidades ===
-                int max_lft = -1;
-                for (int node_id : possibles) {
-                    max_lft = max(max_lft, nodes[node_id].latest_finish);
-                }
+        number_of_jobs = activities + 2;
+        number_of_nondummy_jobs = activities;
+        number_of_renewable_resources = instance.number_of_renewable_resources;
+        renewable_resource_availability = instance.renewable_resource_availability;
 
-                int total = 0;
-                for (int node_id : possibles) {
-                    total += max_lft - nodes[node_id].latest_finish + 1;
-                }
-                    
-                for (int node_id : possibles) {
-                    nodes[node_id].selection_probability =
-                        double(max_lft - nodes[node_id].latest_finish + 1) / total;
-                }
-                    
-                double total_prob = 0.0;
-                for (int node_id : possibles) {
-                    total_prob += nodes[node_id].selection_probability;
-                }
-                    
-                uniform_real_distribution<double> dist(0.0, total_prob);
-                double r = dist(rng);
+        nodes.resize(number_of_jobs);
+        for (int i = 0; i < number_of_jobs; ++i) nodes[i].id = i;
 
-                double acc = 0.0;
-                int selected_node = possibles.back();
+        int sink = number_of_jobs - 1;
+        nodes[0].renewable_resource_requirements = instance.nodes[0].renewable_resource_requirements;
+        nodes[sink].renewable_resource_requirements = instance.nodes[instance_sink].renewable_resource_requirements;
 
-                for (int nid : possibles) {
-                    acc += nodes[nid].selection_probability;
-                    if (r < acc) {
-                        selected_node = nid;
-                        break;
-                    }
-                }
+        for (int l = 0; l < activities; ++l) {
+            const node &original = instance.nodes[groups.member_nodes[first + l]];
+            node &nd = nodes[l + 1];
+            nd.duration_time = original.duration_time;
+            nd.renewable_resource_requirements = original.renewable_resource_requirements;
+            horizon += nd.duration_time;
 
-                selected_nodes.push_back(selected_node);
-                unselected_nodes.erase(
-                    std::remove(unselected_nodes.begin(),
-                                unselected_nodes.end(),
-                                selected_node),
-                    unselected_nodes.end()
-                );
+            for (int succ_id : original.successors) {
+                nd.successors.push_back(succ_id == instance_sink ? sink : groups.local_of_node[succ_id] + 1);
             }
+            if (find(original.predecessors.begin(), original.predecessors.end(), 0) != original.predecessors.end()) {
+                nodes[0].successors.push_back(l + 1);
+            }
+        }
 
-            new_dummy.activity_list = selected_nodes;
-            population.push_back(new_dummy);
+        for (int i = 0; i < number_of_jobs; ++i) {
+            for (int succ_id : nodes[i].successors) nodes[succ_id].predecessors.push_back(i);
         }
 
-        return population;
+        build_precedence_index();
     }
 
     /**
-     * @brief Crossover: Realiza os casamentos para gerar novas soluções para uma determinada população.
+     * @brief Indexa os arcos de precedência diretos em precedence_arcs e conta
+     * os predecessores de cada tarefa.
+     * Chamado ao final da leitura/montagem da instância.
      */
-    vector<individual> crossover(vector<individual> population) {
-        random_device rd;
-        mt19937 rng(rd());
-        shuffle(population.begin(), population.end(), rng);
+    void build_precedence_index() {
+        size_t number_of_arcs = 0;
+        for (const node &nd : nodes) number_of_arcs += nd.successors.size();
 
-        int half = population.size() / 2;
-        vector<individual> mothers(population.begin(), population.begin() + half);
-        vector<individual> fathers(population.begin() + half, population.end());
+        precedence_arcs.reset(number_of_arcs);
+        for (const node &nd : nodes) {
+            for (int succ_id : nd.successors) precedence_arcs.insert(nd.id, succ_id);
+        }
 
-        vector<individual> offspring;
-        size_t n = min(mothers.size(), fathers.size());
+        request_rows.assign((size_t)nodes.size() * number_of_renewable_resources, 0);
+        for (const node &nd : nodes) {
+            copy(nd.renewable_resource_requirements.begin(), nd.renewable_resource_requirements.end(),
+                 request_rows.begin() + (size_t)nd.id * number_of_renewable_resources);
+        }
 
-        int max_q = number_of_nondummy_jobs - 1;
-        uniform_int_distribution<int> dist(1, max_q);
-        int q = dist(rng);
+        build_job_classes();
+        build_critical_paths();
+        build_compact_instance();
+        select_decoders();
 
-        for (size_t i = 0; i < n; i++) {
-            auto& mother = mothers[i];
-            auto& father = fathers[i];
+        // contadores do parallel SGS sobre o grafo reduzido
+        number_of_predecessors.resize(nodes.size());
+        for (const node &nd : nodes) number_of_predecessors[nd.id] = (int)compact.predecessors[nd.id].size();
+    }
 
-            individual daughter;
+    /**
+     * @brief Monta compact a partir dos node (e de request_rows) e faz o
+     * pré-processamento do grafo: redução transitiva dos arcos de compact e
+     * matriz de classes disjuntivas. Depende de job_class e de
+     * topological_rank. Os tempos do CPM só são copiados se já estiverem
+     * calculados; senão forward_backward_scheduling os copia depois.
+     */
+    void build_compact_instance() {
+        auto start = chrono::steady_clock::now();
+        int n = (int)nodes.size();
+        compact.number_of_jobs = n;
+        compact.number_of_resources = number_of_renewable_resources;
+        compact.predecessors.assign(n, [&](int j) -> const vector<int> & { return nodes[j].predecessors; });
+        compact.successors.assign(n, [&](int j) -> const vector<int> & { return nodes[j].successors; });
+
+        vector<int> durations(n);
+        for (int j = 0; j < n; ++j) durations[j] = nodes[j].duration_time;
+        compact.durations.assign(durations);
+        compact.requests.assign(request_rows);
+
+        if (cpm_computed) store_cpm_times();
+
+        preprocessing = graph_preprocessing::report();
+        preprocessing.arcs = compact.successors.ids.size();
+        vector<char> redundant = graph_preprocessing::redundant_arcs(compact.successors, topological_rank);
+        preprocessing.redundant_arcs = count(redundant.begin(), redundant.end(), 1);
+        if (preprocessing.redundant_arcs > 0) {
+            graph_preprocessing::remove_arcs(compact.successors, compact.predecessors, redundant);
+        }
 
-            vector<int> mother_input_d(mother.activity_list.begin(), 
-                mother.activity_list.begin() + q);
+        // duração e demandas de um representante de cada classe
+        int K = number_of_renewable_resources;
+        int number_of_classes = (int)dominated_classes.size();
+        vector<int> class_duration(number_of_classes, 0), class_request((size_t)number_of_classes * K, 0);
+        for (int j = n - 1; j >= 0; --j) {
+            class_duration[job_class[j]] = durations[j];
+            copy_n(request_rows.begin() + (size_t)j * K, K, class_request.begin() + (size_t)job_class[j] * K);
+        }
+        disjunctive_classes.build(number_of_classes, K, class_duration, class_request,
+                                  renewable_resource_availability);
+        preprocessing.disjunctive_pairs = disjunctive_classes.count();
+        symmetry.detect(compact);
+        preprocessing.graph_ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    }
 
-            vector<int> father_input_d;
-            for (int activity : father.activity_list) {
-                if (find(mother_input_d.begin(), mother_input_d.end(), activity) == mother_input_d.end()) {
-                    father_input_d.push_back(activity);
-                }
-            }
+    /// @brief Copia os tempos do CPM dos node para os vetores de compact.
+    void store_cpm_times() {
+        compact.earliest_start.resize(nodes.size());
+        compact.earliest_finish.resize(nodes.size());
+        compact.latest_start.resize(nodes.size());
+        compact.latest_finish.resize(nodes.size());
+        for (const node &nd : nodes) {
+            compact.earliest_start[nd.id] = nd.earliest_start;
+            compact.earliest_finish[nd.id] = nd.earliest_finish;
+            compact.latest_start[nd.id] = nd.latest_start;
+            compact.latest_finish[nd.id] = nd.latest_finish;
+        }
+    }
 
-            daughter.activity_list = mother_input_d;
-            daughter.activity_list.insert(
-                daughter.activity_list.end(),
-                father_input_d.begin(), 
-                father_input_d.end()
-            );
-            offspring.push_back(daughter);
+    /**
+     * @brief Escolhe os decodificadores especializados para o número de
+     * recursos da instância (1 a 8); acima disso, ou com specialize falso,
+     * a versão dinâmica.
+     */
+    void select_decoders(bool specialize = true) {
+        switch (specialize ? number_of_renewable_resources : 0) {
+            case 1: decoders = decoder_family_for<1>(); break;
+            case 2: decoders = decoder_family_for<2>(); break;
+            case 3: decoders = decoder_family_for<3>(); break;
+            case 4: decoders = decoder_family_for<4>(); break;
+            case 5: decoders = decoder_family_for<5>(); break;
+            case 6: decoders = decoder_family_for<6>(); break;
+            case 7: decoders = decoder_family_for<7>(); break;
+            case 8: decoders = decoder_family_for<8>(); break;
+            default: decoders = decoder_family_for<0>(); break;
+        }
+    }
 
-            individual son;
- 
-            vector<int> father_input_s(father.activity_list.begin(),
-                father.activity_list.begin() + q);
+    template <int K> static decoder_family decoder_family_for() {
+        return {&project::parallel_SGS_fixed<K>, &project::serial_SGS_positions_fixed<K>, K};
+    }
 
-            vector<int> mother_input_s;
-            for (int activity : mother.activity_list) {
-                if (find(father_input_s.begin(), father_input_s.end(), activity) == father_input_s.end()) {
-                    mother_input_s.push_back(activity);
-                }
-            }
+    /// @brief Demandas da tarefa em request_rows (K = 0: número de recursos da instância).
+    template <int K> const int *request_row(int node_id) const {
+        return request_rows.data() + (size_t)node_id * (K > 0 ? K : number_of_renewable_resources);
+    }
 
-            son.activity_list = father_input_s;
-            son.activity_list.insert(
-                son.activity_list.end(),
-                mother_input_s.begin(), 
-                mother_input_s.end()
-            );
-            offspring.push_back(son);
+    /**
+     * @brief Calcula critical_head e critical_tail pelo algoritmo de Kahn (nos
+     * dois sentidos), sem depender da numeração das tarefas nem do horizonte.
+     * Laços de uma tarefa sobre si mesma são ignorados; tarefas num ciclo ficam
+     * com cabeça/cauda 0, que continuam sendo limitantes válidos.
+     */
+    void build_critical_paths() {
+        critical_head = longest_paths(&node::predecessors, &node::successors);
+        critical_tail = longest_paths(&node::successors, &node::predecessors);
+        build_topological_rank();
+    }
+
+    /// @brief Kahn pelo menor id disponível; tarefas em ciclos ficam no fim.
+    void build_topological_rank() {
+        topological_rank.assign(nodes.size(), (int)nodes.size());
+
+        vector<int> remaining(nodes.size(), 0);
+        priority_queue<int, vector<int>, greater<int>> ready;
+        for (const node &nd : nodes) {
+            for (int pred_id : nd.predecessors) {
+                if (pred_id != nd.id) remaining[nd.id]++;
+            }
+            if (remaining[nd.id] == 0) ready.push(nd.id);
         }
 
-        return offspring;
+        int rank = 0;
+        while (!ready.empty()) {
+            int id = ready.top();
+            ready.pop();
+            topological_rank[id] = rank++;
+            for (int succ_id : nodes[id].successors) {
+                if (succ_id != id && --remaining[succ_id] == 0) ready.push(succ_id);
+            }
+        }
     }
 
-    vector<individual> mutate(vector<individual> offsprings, double mutation_probability) {
-        random_device rd;
-        mt19937 rng(rd());
+    /**
+     * @brief Maior caminho até cada tarefa percorrendo o grafo de 'from' para
+     * 'to': uma tarefa é processada quando todos os seus vizinhos em 'from' já
+     * foram, e empurra (caminho + duração) para os vizinhos em 'to'.
+     */
+    vector<int> longest_paths(vector<int> node::*from, vector<int> node::*to) const {
+        vector<int> path(nodes.size(), 0);
+
+        vector<int> remaining(nodes.size(), 0);
+        vector<int> ready;
+        for (const node &nd : nodes) {
+            for (int other : nd.*from) {
+                if (other != nd.id) remaining[nd.id]++;
+            }
+            if (remaining[nd.id] == 0) ready.push_back(nd.id);
+        }
 
-        for (auto &individual : offsprings) {
-            for (size_t i = 0; i + 1 < individual.activity_list.size(); i++) {
-                uniform_real_distribution<double> dist(0.0, 1.0);
-                double r = dist(rng);
+        while (!ready.empty()) {
+            int id = ready.back();
+            ready.pop_back();
+            int reach = path[id] + nodes[id].duration_time;
 
-                if (r < mutation_probability) {
-                    vector<int> stored_current_activity_list = individual.activity_list;
-                    swap(individual.activity_list[i], individual.activity_list[i + 1]);
-                    if (!individual.check_precedence_feasibility(nodes)) {
-                        individual.activity_list = stored_current_activity_list;
-                    }      
-                }
+            for (int other : nodes[id].*to) {
+                if (other == id) continue;
+                path[other] = max(path[other], reach);
+                if (--remaining[other] == 0) ready.push_back(other);
+            }
+        }
+        return path;
+    }
+
+    /**
+     * @brief Calcula os limitantes inferiores (lower_bounds.hpp) a partir das
+     * durações, demandas e caminhos críticos. Não faz nada se já foram
+     * calculados para a instância carregada.
+     * @param log destino do resumo do pré-processamento e dos limitantes
+     */
+    void compute_bounds(ostream &log = cout) {
+        if (bounds_computed || nodes.empty()) return;
+
+        int K = number_of_renewable_resources;
+        vector<int> durations(number_of_jobs), requests((size_t)number_of_jobs * K, 0);
+        for (const node &nd : nodes) {
+            durations[nd.id] = nd.duration_time;
+            for (int k = 0; k < K && k < (int)nd.renewable_resource_requirements.size(); ++k) {
+                requests[(size_t)nd.id * K + k] = nd.renewable_resource_requirements[k];
             }
         }
 
-        return offsprings;
+        bounds = compute_lower_bounds(number_of_jobs, K, durations, requests, renewable_resource_availability,
+                                      critical_head, critical_tail, horizon);
+        bounds.windows = windows_bound(bounds.best());
+        bounds_computed = true;
+
+        ostringstream times;
+        times << fixed << setprecision(2) << "grafo " << preprocessing.graph_ms << " ms | janelas "
+              << preprocessing.windows_ms << " ms";
+        log << "[GA] Pre-processamento: " << preprocessing.redundant_arcs << " de " << preprocessing.arcs
+             << " arcos redundantes removidos | " << preprocessing.disjunctive_pairs << " pares de classes disjuntivas"
+             << " | " << symmetry.members() << " pacientes identicos em " << symmetry.groups() << " grupos"
+             << " | " << times.str() << endl;
+        log << "[GA] Limitantes inferiores: caminho critico " << bounds.critical_path
+             << " | trabalho/capacidade " << bounds.resource_work
+             << " | disjuntivo " << bounds.disjunctive
+             << " | bin packing " << bounds.bin_packing
+             << " | energetico " << bounds.energetic
+             << " | janelas " << bounds.windows
+             << " | melhor " << bounds.best() << endl;
     }
 
     /**
-     * @brief Rank and Reduce: Avalia os filhos, une com a população atual, ordena e corta.
-     * Agora aceita ponteiro para função membro (project::*sgs).
+     * @brief Menor makespan que as janelas apertadas (windows_feasible) não
+     * descartam, por bisseção entre low e o horizonte, como o energético.
+     * Devolve low se a instância tem ciclos ou a matriz de pares está desligada.
      */
-    pair<vector<individual>, individual> rank_and_reduce(
-        vector<individual> current_population, 
-        vector<individual> offsprings, 
-        individual incumbent, 
-        void (project::*sgs)(individual &)) 
-    { 
-        // 1. Avaliar os filhos usando o SGS passado
-        for (individual &indiv : offsprings) {
-            (this->*sgs)(indiv);
-        }
-
-        // 2. Unir populações
-        vector<individual> new_population = current_population;
-        new_population.insert(new_population.end(), offsprings.begin(), offsprings.end());
-
-        // 3. Ordenar (Menor makespan é melhor)
-        sort(new_population.begin(), new_population.end(), 
-            [](const individual& a, const individual& b) { 
-                return a.fitness < b.fitness; 
-        });
+    int windows_bound(int low) {
+        auto start = chrono::steady_clock::now();
+        vector<int> order(number_of_jobs);
+        for (int j = 0; j < number_of_jobs; ++j) {
+            if (topological_rank[j] >= number_of_jobs) return low;
+            order[topological_rank[j]] = j;
+        }
 
-        // 4. Reduzir para o tamanho original
-        if (new_population.size() > current_population.size()) {
-            new_population.resize(current_population.size());
+        auto feasible = [&](int T) {
+            return graph_preprocessing::windows_feasible(T, compact, job_class, disjunctive_classes, order,
+                                                         critical_head, critical_tail);
+        };
+        int high = max(low, horizon);
+        if (preprocessing.disjunctive_pairs > 0 && !feasible(low)) {
+            // invariante: low inviável, high viável (ou o teto)
+            while (high - low > 1) {
+                int middle = low + (high - low) / 2;
+                if (feasible(middle)) high = middle;
+                else low = middle;
+            }
+            low = high;
         }
+        preprocessing.windows_ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        return low;
+    }
 
-        // 5. Atualizar Incumbent (Melhor global)
-        if (new_population[0].fitness < incumbent.fitness) {
-            incumbent = new_population[0];
+    /**
+     * @brief Agrupa as tarefas por (duração, demandas) em job_class e monta
+     * dominated_classes. Com muitas classes (instâncias sem repetição) a
+     * dominância fica restrita à própria classe, para não gastar O(classes^2).
+     */
+    void build_job_classes() {
+        auto signature_less = [&](int a, int b) {
+            if (nodes[a].duration_time != nodes[b].duration_time)
+                return nodes[a].duration_time < nodes[b].duration_time;
+            return nodes[a].renewable_resource_requirements < nodes[b].renewable_resource_requirements;
+        };
+
+        vector<int> ids(nodes.size());
+        for (size_t i = 0; i < ids.size(); ++i) ids[i] = (int)i;
+        sort(ids.begin(), ids.end(), signature_less);
+
+        vector<int> representative;
+        job_class.assign(nodes.size(), 0);
+        for (size_t i = 0; i < ids.size(); ++i) {
+            if (i == 0 || signature_less(ids[i - 1], ids[i])) representative.push_back(ids[i]);
+            job_class[ids[i]] = (int)representative.size() - 1;
         }
 
-        return {new_population, incumbent};
+        const size_t max_classes_for_dominance = 256;
+        int number_of_classes = (int)representative.size();
+        dominated_classes.assign(number_of_classes, {});
+        for (int c = 0; c < number_of_classes; ++c) {
+            const node &small = nodes[representative[c]];
+            for (int d = 0; d < number_of_classes; ++d) {
+                if (d != c && representative.size() > max_classes_for_dominance) continue;
+                const node &large = nodes[representative[d]];
+
+                bool dominated = small.duration_time <= large.duration_time;
+                for (int k = 0; k < number_of_renewable_resources && dominated; ++k) {
+                    dominated = small.renewable_resource_requirements[k] <= large.renewable_resource_requirements[k];
+                }
+                if (dominated) dominated_classes[c].push_back(d);
+            }
+        }
     }
 
-    void serial_SGS(individual &individual) {
+    /**
+     * @brief Imprime os detalhes do projeto carregado no console.
+     * Útil para debug e validação do parser.
+     */
+    void print_project() {
+        if (nodes.empty()) {
+            cout << "O projeto está vazio ou não foi carregado corretamente." << endl;
+            return;
+        }
 
-        for (auto& node : nodes) {
+        cout << "==========================================================" << endl;
+        cout << "                PROJECT SUMMARY                           " << endl;
+        cout << "==========================================================" << endl;
+        cout << "Total Jobs (incl. dummy): " << number_of_jobs << endl;
+        cout << "Real Jobs:                " << number_of_nondummy_jobs << endl;
+        cout << "Horizon:                  " << horizon << endl;
+        cout << "Renewable Resources:      " << number_of_renewable_resources << endl;
+        
+        cout << "Resource Availabilities:  [ ";
+        for (int avail : renewable_resource_availability) {
+            cout << avail << " ";
+        }
+        cout << "]" << endl << endl;
 
-            auto it = find(individual.activity_list.begin(),
-                           individual.activity_list.end(),
-                           node.id);
+        cout << "----------------------------------------------------------" << endl;
+        cout << " JOB DETAILS (ID | Dur | Res | Succs | Preds)" << endl;
+        cout << "----------------------------------------------------------" << endl;
 
-            if(it != individual.activity_list.end()) {
-                node.priority_value = distance(individual.activity_list.begin(), it);
-            } else {
-                node.priority_value = number_of_jobs + 1.0;
+        for (const auto& node : nodes) {
+            cout << "Job " << node.id + 1;
+            cout << "\t| Dur: " << node.duration_time;
+            
+            // Requisitos de Recursos
+            cout << "\t| Res: [";
+            for (size_t k = 0; k < node.renewable_resource_requirements.size(); ++k) {
+                cout << node.renewable_resource_requirements[k] << (k < node.renewable_resource_requirements.size() - 1 ? " " : "");
             }
+            cout << "]";
 
-            node.start_time = -1;
-            node.finish_time = -1;
-            node.started = false;
-            node.finished = false;
-            node.scheduled = false;  
+            cout << "\t| Succ: {";
+            for (size_t k = 0; k < node.successors.size(); ++k) {
+                cout << node.successors[k] + 1 << (k < node.successors.size() - 1 ? "," : "");
+            }
+            cout << "}";
+            
+            // Predecessores (Opcional, para verificar lógica inversa)
+            /*
+            cout << "\t| Pred: {";
+            for (size_t k = 0; k < node.predecessors.size(); ++k) {
+                cout << node.predecessors[k] + 1 << (k < node.predecessors.size() - 1 ? "," : "");
+            }
+            cout << "}";
+            */
+            
+            cout << endl;
         }
+        cout << "==========================================================" << endl;
+    }
 
-            vector<vector<int>> R_kt;
-
-            for (int k : renewable_resource_availability) {
-                R_kt.push_back(vector<int>(horizon, k));
-            }
+    /**
+     * @brief Grava o projeto no formato .sm lido por read_project (o mesmo
+     * layout de instances_generator.py).
+     * @return bool Falso se o arquivo não pôde ser escrito.
+     */
+    bool write_project(const string &full_path) const {
+        ofstream file(full_path);
+        if (!file.is_open()) {
+            cerr << "Erro: Não foi possível criar o arquivo " << full_path << endl;
+            return false;
+        }
 
-            unordered_set<int> scheduled_activities;
-            node& starting_node = nodes[0];
-            starting_node.start_time = 0;
-            starting_node.finish_time = 0;
-            starting_node.started = true;
-            starting_node.finished = true;
-            starting_node.scheduled = true;
+        file << "jobs (incl. supersource/sink ): " << number_of_jobs << '\n';
+        file << "horizon:                         " << horizon << '\n';
+        file << "renewable resources:             " << number_of_renewable_resources << "\n\n";
 
-            scheduled_activities.insert(starting_node.id);
+        file << "PRECEDENCE RELATIONS:\n- jobnr. mode successors...\n";
+        for (const node &nd : nodes) {
+            file << "  " << nd.id + 1 << "   1   " << nd.successors.size() << "   ";
+            for (int succ_id : nd.successors) file << ' ' << succ_id + 1;
+            file << '\n';
+        }
 
-            vector<int> eligibles = starting_node.successors;  
-            sort(eligibles.begin(), eligibles.end(), [&](int a, int b) {
-                return nodes[a].priority_value < nodes[b].priority_value;
-            });
+        file << "\nREQUESTS/DURATIONS:\n- jobnr. mode duration";
+        for (int k = 0; k < number_of_renewable_resources; ++k) file << " R" << k + 1;
+        file << '\n';
+        for (const node &nd : nodes) {
+            file << "  " << nd.id + 1 << "   1   " << nd.duration_time << "   ";
+            for (int req : nd.renewable_resource_requirements) file << ' ' << req;
+            file << '\n';
+        }
 
-            vector<int> resource_profile_changes;
-            resource_profile_changes.push_back(0);
+        file << "\nRESOURCEAVAILABILITIES:\n";
+        for (int k = 0; k < number_of_renewable_resources; ++k) file << (k ? " R" : "R") << k + 1;
+        file << '\n';
+        for (int k = 0; k < number_of_renewable_resources; ++k) file << (k ? " " : "") << renewable_resource_availability[k];
+        file << '\n';
 
-            while (scheduled_activities.size() != number_of_jobs) {
+        return (bool)file;
+    }
 
-                int selected_id = eligibles[0];
-                node& selected_node = nodes[selected_id];
+    /**
+     * @brief Create Initial Population: Preenche as listas de atividades dos
+     * membros da população (o primeiro membro é a lista ordenada por LFT).
+     * * Os demais membros são amostrados por arrependimento sobre o LFT: a cada
+     * passo uma elegível é sorteada com peso (maior LFT entre as elegíveis) -
+     * LFT + 1. As elegíveis são mantidas incrementalmente com contadores de
+     * predecessores restantes e sorteadas num regret_sampler (Fenwick), então
+     * cada lista custa O((n + arcos) log n).
+     */
+    void create_initial_population(population_storage &population, mt19937 &generator) {
 
-                int current_t = -1;
-                for (int pred_id : selected_node.predecessors) {
-                    node& pred = nodes[pred_id];
-                    current_t = max(current_t, pred.start_time + pred.duration_time);
-                }
+        forward_backward_scheduling();
 
-                while (!selected_node.scheduled) {
-                    bool violation = false;
+        // Postos por LFT crescente; o empate pelo ID mantém a lista viável
+        // quando um sucessor de duração zero tem o mesmo LFT do predecessor.
+        vector<int> nodes_id_sorted_by_min_lft;
+        for (auto &nd : nodes)
+            nodes_id_sorted_by_min_lft.push_back(nd.id);
 
-                    for (int k = 0; k < number_of_renewable_resources; k++) {
-                        for (int t = current_t; t < current_t + selected_node.duration_time; t++) {
+        sort(nodes_id_sorted_by_min_lft.begin(),
+                nodes_id_sorted_by_min_lft.end(),
+                [&](int a, int b){
+                    if (compact.latest_finish[a] != compact.latest_finish[b])
+                        return compact.latest_finish[a] < compact.latest_finish[b];
+                    return a < b;
+                });
 
-                            if (selected_node.renewable_resource_requirements[k] > R_kt[k][t]) {
-                                violation = true;
+        copy(nodes_id_sorted_by_min_lft.begin(), nodes_id_sorted_by_min_lft.end(),
+             population.activity_list(population.members[0]));
 
-                                int new_t = INT_MAX;
-                                for (int c : resource_profile_changes) {
-                                    if (c > current_t) new_t = min(new_t, c);
-                                }
-                                current_t = new_t;
-                                break;
-                            }
-                        }
-                        if (violation) break;
-                    }
+        vector<int> lft_rank(number_of_jobs);
+        vector<long long> lft(number_of_jobs);
+        for (int r = 0; r < number_of_jobs; ++r) lft_rank[nodes_id_sorted_by_min_lft[r]] = r;
+        for (int j = 0; j < number_of_jobs; ++j) lft[j] = compact.latest_finish[j];
 
-                    if (!violation) {
+        // Predecessores no grafo reduzido (compact); laços do nó sobre si
+        // mesmo não contam.
+        vector<int> number_of_predecessors(number_of_jobs, 0);
+        for (int id = 0; id < number_of_jobs; ++id) {
+            for (int successor : compact.successors[id]) {
+                if (successor != id) number_of_predecessors[successor]++;
+            }
+        }
 
-                        selected_node.scheduled  = true;
-                        selected_node.start_time = current_t;
-                        selected_node.finish_time = current_t + selected_node.duration_time;
-                        selected_node.started = true;
-                        selected_node.finished = true;
+        vector<int> remaining_predecessors;
+        regret_sampler eligibles;
 
-                        for (int k = 0; k < number_of_renewable_resources; k++) {
-                            for (int t = current_t; t < current_t + selected_node.duration_time; t++) {
-                                R_kt[k][t] -= selected_node.renewable_resource_requirements[k];
-                            }
-                        }
+        for (size_t p = 1; p < population.members.size(); p++) {
+            int *activity_list = population.activity_list(population.members[p]);
+            int length = 0;
 
-                        resource_profile_changes.clear();
-                        for (node& nd : nodes) {
-                            if (nd.finish_time >= 0)
-                                resource_profile_changes.push_back(nd.finish_time);
-                        }
+            remaining_predecessors = number_of_predecessors;
+            eligibles.reset(number_of_jobs);
 
-                        sort(resource_profile_changes.begin(), resource_profile_changes.end());
-                        resource_profile_changes.erase(
-                            unique(resource_profile_changes.begin(), resource_profile_changes.end()),
-                            resource_profile_changes.end()
-                        );
+            auto select = [&](int node_id) {
+                activity_list[length++] = node_id;
+                for (int successor : compact.successors[node_id]) {
+                    if (successor == node_id) continue;
+                    if (--remaining_predecessors[successor] == 0) {
+                        eligibles.insert(lft_rank[successor], lft[successor]);
                     }
                 }
+            };
+
+            for (int node_id = 1; node_id < number_of_jobs; ++node_id) {
+                if (remaining_predecessors[node_id] == 0) {
+                    eligibles.insert(lft_rank[node_id], lft[node_id]);
+                }
+            }
 
-                scheduled_activities.insert(selected_node.id);
+            // o nó fonte é sempre o primeiro
+            select(0);
 
-                eligibles.erase(
-                    remove(eligibles.begin(), eligibles.end(), selected_node.id),
-                    eligibles.end()
-                );
+            while (!eligibles.empty()) {
+                long long max_lft = lft[nodes_id_sorted_by_min_lft[eligibles.highest_rank()]];
 
-                for (int succ_id : selected_node.successors) {
-                    node& succ = nodes[succ_id];
+                uniform_int_distribution<long long> dist(0, eligibles.total_weight(max_lft) - 1);
+                int rank = eligibles.sample(dist(generator), max_lft);
 
-                    bool all_preds_scheduled = true;
-                    for (int pred_id : succ.predecessors) {
-                        if (!nodes[pred_id].scheduled) {
-                            all_preds_scheduled = false;
-                            break;
-                        }
-                    }
+                int selected_node = nodes_id_sorted_by_min_lft[rank];
+                eligibles.erase(rank, lft[selected_node]);
+                select(selected_node);
+            }
+        }
+    }
+
+    /**
+     * @brief Crossover: Realiza os casamentos para gerar novas soluções para uma determinada população.
+     * * Os pais são sorteados permutando os índices dos membros e os filhos são
+     * escritos diretamente nos slots livres (population.offspring). O operador
+     * (um ou dois pontos) é escolhido por crossover_type; os pontos de corte são
+     * sorteados uma vez por geração.
+     */
+    void crossover(population_storage &population, mt19937 &generator) {
+        vector<int> &order = population.order;
+        order.assign(population.members.begin(), population.members.end());
+        shuffle(order.begin(), order.end(), generator);
+
+        size_t half = order.size() / 2;
+        size_t n = min(half, population.offspring.size() / 2);
+
+        int max_q = number_of_nondummy_jobs - 1;
+        uniform_int_distribution<int> dist(1, max_q);
+        int q1 = dist(generator);
+        int q2 = number_of_jobs;
+
+        if (crossover_type == crossover_operator::two_point) {
+            q2 = dist(generator);
+            if (q2 < q1) swap(q1, q2);
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            const int *mother = population.activity_list(order[i]);
+            const int *father = population.activity_list(order[half + i]);
+
+            crossover_child(mother, father, q1, q2, population.activity_list(population.offspring[2 * i]), population);
+            crossover_child(father, mother, q1, q2, population.activity_list(population.offspring[2 * i + 1]), population);
 
-                    if (all_preds_scheduled &&
-                        find(eligibles.begin(), eligibles.end(), succ_id) == eligibles.end()) {
-                        eligibles.push_back(succ_id);
+            // cada filho começa com o prefixo do primeiro pai (checkpoints do serial SGS)
+            population.checkpoints.set_parent(population.offspring[2 * i], order[i]);
+            population.checkpoints.set_parent(population.offspring[2 * i + 1], order[half + i]);
+        }
+    }
+
+    /**
+     * @brief Mutação: percorre cada filho e, com probabilidade mutation_probability
+     * por posição, aplica o operador escolhido em mutation_type.
+     * * adjacent_swap: troca as atividades das posições i e i+1. Como a lista já é
+     * viável, a troca só quebra a precedência se a atividade em i for predecessora
+     * direta da atividade em i+1, o que é consultado em O(1) em precedence_arcs.
+     * * shift: move a atividade da posição i para uma posição sorteada dentro da
+     * sua janela viável (depois do último predecessor e antes do primeiro
+     * sucessor), deslocando as intermediárias.
+     * * Nenhum dos dois copia a lista.
+     */
+    void mutate(population_storage &population, double mutation_probability, mt19937 &generator) {
+        vector<int> &position_in_list = population.positions;
+        uniform_real_distribution<double> dist(0.0, 1.0);
+
+        for (int slot : population.offspring) {
+            int *activity_list = population.activity_list(slot);
+
+            if (mutation_type == mutation_operator::adjacent_swap) {
+                for (int i = 0; i + 1 < number_of_jobs; i++) {
+                    double r = dist(generator);
+
+                    if (r < mutation_probability &&
+                        !precedence_arcs.contains(activity_list[i], activity_list[i + 1])) {
+                        swap(activity_list[i], activity_list[i + 1]);
                     }
                 }
-
-                sort(eligibles.begin(), eligibles.end(), [&](int a, int b){
-                    return nodes[a].priority_value < nodes[b].priority_value;
-                });
+                continue;
             }
 
-            int best = -1;
-            for (int id : scheduled_activities) {
-                best = max(best, nodes[id].finish_time);
+            position_in_list.resize(number_of_jobs);
+            for (int i = 0; i < number_of_jobs; ++i) position_in_list[activity_list[i]] = i;
+
+            for (int i = 0; i < number_of_jobs; i++) {
+                double r = dist(generator);
+
+                if (r < mutation_probability) {
+                    shift_activity(activity_list, position_in_list, i, generator);
+                }
             }
-            individual.fitness = best;
+        }
     }
 
     /**
-     * @brief Parallel Schedule Generation Scheme (SGS).
-     * Constrói um cronograma iterando sobre o tempo. Em cada ponto de decisão (t),
-     * tenta agendar o máximo de atividades elegíveis possível respeitando os recursos.
-     * Quando nada mais cabe em (t), avança para o próximo tempo de término de uma atividade.
-     * * @param individual O indivíduo (cromossomo) a ser avaliado. Passado por referência para atualizar o fitness.
+     * @brief Rank and Reduce: une os filhos (já avaliados) com a população atual,
+     * ordena e corta, trocando apenas índices.
+     * Atualiza o incumbent (melhor global) se o melhor membro o superar.
+     * @return bool Verdadeiro se o incumbent melhorou.
      */
-    void parallel_SGS(individual &individual) {
-        
-        vector<int> priority_map(number_of_jobs);
-        for(size_t i = 0; i < individual.activity_list.size(); ++i) {
-            priority_map[individual.activity_list[i]] = (int)i;
+    bool rank_and_reduce(population_storage &population, individual &incumbent) const {
+        population.reduce();
+
+        int best = population.best();
+        if (population.fitness[best] < incumbent.fitness) {
+            incumbent = extract_individual(population, best);
+            return true;
         }
+        return false;
+    }
+
+    /**
+     * @brief Serial Schedule Generation Scheme (SGS).
+     * Percorre a activity_list em ordem (ela é viável em precedência, então a
+     * próxima da lista é sempre a elegível de menor posição) e agenda cada
+     * atividade no primeiro instante viável (precedência e recursos) a partir
+     * do término dos predecessores.
+     * * Os candidatos a início são os términos já agendados, mantidos num vetor
+     * ordenado que recebe cada novo término por inserção. Quando a atividade não
+     * cabe, o perfil informa o fim do primeiro segmento sem recurso e a busca
+     * salta direto para o primeiro término a partir dele: os términos anteriores
+     * também não caberiam. O resultado é o mesmo de serial_SGS_reference.
+     * * Não altera o project: todo o estado fica em ctx, que ao final contém o
+     * cronograma (ctx.start_time / ctx.finish_time).
+     * @return double O makespan do cronograma gerado (2 * horizon se alguma
+     * atividade exigir mais que a capacidade).
+     */
+    double serial_SGS(const int *activity_list, evaluation_context &ctx) const {
+        if (nodes.empty()) return 0;
+        start_serial_SGS(activity_list, ctx);
 
-        for (auto& node : nodes) {
-            node.priority_value = priority_map[node.id];
+        int makespan = 0;
+        decode_status status = serial_SGS_positions(activity_list, 0, number_of_jobs, ctx, makespan);
+        return status == decode_status::complete ? makespan : stopped_fitness(status);
+    }
 
-            node.start_time = -1;
-            node.finish_time = -1;
-            node.started = false;
-            node.finished = false;
-            node.scheduled = false;
+    /**
+     * @brief Serial SGS no grafo de precedências invertido: percorre a lista
+     * (que deve ser viável no grafo invertido, sucessores antes dos
+     * predecessores) e agenda cada atividade o mais tarde possível, no
+     * primeiro instante viável de um eixo de tempo que corre do fim do
+     * projeto para o início.
+     * * No final os tempos são trazidos de volta ao eixo normal (início =
+     * makespan - término invertido), então o cronograma em ctx começa em 0,
+     * termina no makespan retornado e tem as atividades "encostadas à direita".
+     * @return double O makespan (2 * horizon se alguma atividade exigir mais
+     * que a capacidade).
+     */
+    double backward_SGS(const int *activity_list, evaluation_context &ctx) const {
+        if (nodes.empty()) return 0;
+        ctx.reset(activity_list, number_of_jobs, renewable_resource_availability);
+        ctx.resource_profile_changes.push_back(0);
+
+        int makespan = 0;
+        decode_status status = serial_SGS_positions(activity_list, 0, number_of_jobs, ctx, makespan, true);
+        if (status != decode_status::complete) return stopped_fitness(status);
+
+        for (int j = 0; j < number_of_jobs; ++j) {
+            int start = makespan - ctx.finish_time[j];
+            ctx.finish_time[j] = makespan - ctx.start_time[j];
+            ctx.start_time[j] = start;
         }
+        return makespan;
+    }
 
-        vector<vector<int>> matriz_recurso_kt;
-        for(int k : renewable_resource_availability) {
-            // Nota: Se o horizonte for muito curto para uma solução ruim,
-            // isso pode causar problemas se não tratarmos o limite abaixo.
-            matriz_recurso_kt.push_back(vector<int>(horizon + 1, k)); 
+    /**
+     * @brief Forward-backward improvement (justificação dupla) do cronograma
+     * completo do slot, que está em ctx.
+     * * Passada para trás: backward_SGS com as atividades em ordem
+     * decrescente de término, o que empurra cada uma para a direita. Passada
+     * para frente: serial_SGS em ordem crescente dos inícios do cronograma
+     * de trás, o que as traz de volta para a esquerda. Os empates seguem a
+     * ordem topológica, então as duas ordens são viáveis em precedência, e
+     * nenhuma passada aumenta o makespan.
+     * * Se o cronograma final for mais curto, ele substitui o do slot: a
+     * lista passa a ser a ordem da passada para frente (decodificada pelo
+     * serial SGS, reproduz o cronograma), o fitness é atualizado e os
+     * checkpoints descartados. Senão ctx volta ao cronograma de entrada.
+     * @return bool Verdadeiro se o makespan diminuiu.
+     */
+    bool forward_backward_improvement(population_storage &population, int slot, evaluation_context &ctx) const {
+        ctx.justifications++;
+        ctx.original_start = ctx.start_time;
+        ctx.original_finish = ctx.finish_time;
+
+        vector<int> &order = ctx.justification_order;
+        order.resize(number_of_jobs);
+        iota(order.begin(), order.end(), 0);
+        const vector<int> &finish = ctx.original_finish;
+        sort(order.begin(), order.end(), [&](int a, int b) {
+            if (finish[a] != finish[b]) return finish[a] > finish[b];
+            return topological_rank[a] > topological_rank[b];
+        });
+        double backward = backward_SGS(order.data(), ctx);
+
+        double makespan = population.fitness[slot];
+        if (backward <= makespan) {
+            const vector<int> &start = ctx.start_time;
+            sort(order.begin(), order.end(), [&](int a, int b) {
+                if (start[a] != start[b]) return start[a] < start[b];
+                return topological_rank[a] < topological_rank[b];
+            });
+            double forward = serial_SGS(order.data(), ctx);
+            if (forward < makespan) {
+                copy(order.begin(), order.end(), population.activity_list(slot));
+                population.fitness[slot] = forward;
+                population.checkpoints.invalidate(slot);
+                ctx.justification_improvements++;
+                ctx.justification_gain += (long long)(makespan - forward);
+                return true;
+            }
         }
 
-        // Marcar o nó fonte (job 1, index 0) como já agendado no tempo 0.
-        // Sem isso, o laço de elegíveis nunca irá considerar sucessores do
-        // nó fonte porque sua finish_time inicialmente é -1, levando o
-        // algoritmo a avançar o tempo até o horizonte sem agendar nada.
-        if (!nodes.empty()) {
-            node &starting_node = nodes[0];
-            starting_node.start_time = 0;
-            starting_node.finish_time = 0;
-            starting_node.scheduled = true;
+        ctx.start_time.swap(ctx.original_start);
+        ctx.finish_time.swap(ctx.original_finish);
+        return false;
+    }
+
+    /**
+     * @brief Serial SGS retomado de checkpoint: decodifica o slot reaproveitando
+     * o prefixo que ele compartilha com o pai (population.checkpoints) e grava
+     * os checkpoints do próprio slot. Mesmo resultado de serial_SGS.
+     */
+    double serial_SGS_checkpointed(population_storage &population, int slot, evaluation_context &ctx) const {
+        schedule_checkpoints &checkpoints = population.checkpoints;
+        const int *activity_list = population.activity_list(slot);
+        start_serial_SGS(activity_list, ctx);
+
+        int resume = 0;
+        int parent = checkpoints.parent[slot];
+        if (parent >= 0) {
+            const int *parent_list = population.activity_list(parent);
+            int shared = (int)(mismatch(activity_list, activity_list + number_of_jobs, parent_list).first - activity_list);
+            resume = min(shared / checkpoints.interval, checkpoints.saved[parent]);
         }
 
-        int scheduled_count = 1; // já contamos o nó fonte
-        int current_time = 0;
+        int makespan = 0;
+        int position = resume * checkpoints.interval;
+        if (resume > 0) {
+            const schedule_checkpoints::snapshot &snapshot = checkpoints.at(parent, resume);
+            ctx.profile.times = snapshot.times;
+            ctx.profile.available = snapshot.available;
+            ctx.resource_profile_changes = snapshot.finish_times;
+
+            const int *parent_start = population.start_times(parent);
+            const int *parent_finish = population.finish_times(parent);
+            for (int i = 0; i < position; ++i) {
+                int node_id = activity_list[i];
+                ctx.scheduled[node_id] = true;
+                ctx.start_time[node_id] = parent_start[node_id];
+                ctx.finish_time[node_id] = parent_finish[node_id];
+                makespan = max(makespan, parent_finish[node_id]);
+                if (node_id != 0) {
+                    ctx.makespan_bound = max(ctx.makespan_bound, parent_finish[node_id] + critical_tail[node_id]);
+                }
+            }
 
-        vector<int> active_jobs;
+            // os estados do prefixo também valem para os filhos deste slot
+            for (int c = 1; c <= resume; ++c) checkpoints.at(slot, c) = checkpoints.at(parent, c);
+        }
+        checkpoints.saved[slot] = resume;
+        checkpoints.reused_positions[slot] = position;
+
+        for (int c = resume + 1; c <= checkpoints.per_slot; ++c) {
+            int next = c * checkpoints.interval;
+            decode_status status = serial_SGS_positions(activity_list, position, next, ctx, makespan);
+            if (status != decode_status::complete) return stopped_fitness(status);
+            position = next;
+
+            schedule_checkpoints::snapshot &snapshot = checkpoints.at(slot, c);
+            snapshot.times = ctx.profile.times;
+            snapshot.available = ctx.profile.available;
+            snapshot.finish_times = ctx.resource_profile_changes;
+            checkpoints.saved[slot] = c;
+        }
 
-        while (scheduled_count < number_of_jobs) {
-            
-            if (current_time >= horizon) {
-                individual.fitness = (double)horizon * 2.0;
-                return;
+        decode_status status = serial_SGS_positions(activity_list, position, number_of_jobs, ctx, makespan);
+        return status == decode_status::complete ? makespan : stopped_fitness(status);
+    }
+
+    /**
+     * @brief Versão original do serial SGS (conjunto de elegíveis reordenado e
+     * pontos de decisão recalculados a cada atividade). Mantida como referência
+     * de corretude e desempenho para --bench sgs; exige que todas as atividades
+     * sejam alcançáveis a partir do nó fonte.
+     */
+    double serial_SGS_reference(const int *activity_list, evaluation_context &ctx) const {
+        ctx.reset(activity_list, number_of_jobs, renewable_resource_availability);
+
+        const vector<int> &priority = ctx.priority_value;
+        resource_profile &profile = ctx.profile;
+
+        int scheduled_count = 1;
+        ctx.start_time[0] = 0;
+        ctx.finish_time[0] = 0;
+        ctx.scheduled[0] = true;
+
+        vector<int> &eligibles = ctx.eligibles;
+        eligibles = nodes[0].successors;
+        sort(eligibles.begin(), eligibles.end(), [&](int a, int b) {
+            return priority[a] < priority[b];
+        });
+
+        vector<int> &resource_profile_changes = ctx.resource_profile_changes;
+        resource_profile_changes.push_back(0);
+
+        while (scheduled_count != number_of_jobs) {
+
+            int selected_id = eligibles[0];
+            const node &selected_node = nodes[selected_id];
+
+            int current_t = -1;
+            for (int pred_id : selected_node.predecessors) {
+                current_t = max(current_t, ctx.start_time[pred_id] + nodes[pred_id].duration_time);
             }
 
-            vector<int> eligibles;
+            while (!ctx.scheduled[selected_id]) {
+                bool violation = !profile.fits(current_t, selected_node.duration_time,
+                                               selected_node.renewable_resource_requirements.data());
 
-            for (const auto& node : nodes) {
-                if (!node.scheduled) {
-                    bool predecessors_finished = true;
-                    for (int pred_id : node.predecessors) {
-                        if (nodes[pred_id].finish_time == -1 || nodes[pred_id].finish_time > current_time) {
-                            predecessors_finished = false;
-                            break;
-                        }
+                if (violation) {
+                    int new_t = INT_MAX;
+                    for (int c : resource_profile_changes) {
+                        if (c > current_t) new_t = min(new_t, c);
                     }
-                    if (predecessors_finished) {
-                        eligibles.push_back(node.id);
+                    current_t = new_t;
+                } else {
+
+                    ctx.scheduled[selected_id] = true;
+                    ctx.start_time[selected_id] = current_t;
+                    ctx.finish_time[selected_id] = current_t + selected_node.duration_time;
+                    scheduled_count++;
+
+                    profile.book(current_t, selected_node.duration_time,
+                                 selected_node.renewable_resource_requirements.data());
+
+                    resource_profile_changes.clear();
+                    for (int finish : ctx.finish_time) {
+                        if (finish >= 0)
+                            resource_profile_changes.push_back(finish);
                     }
+
+                    sort(resource_profile_changes.begin(), resource_profile_changes.end());
+                    resource_profile_changes.erase(
+                        unique(resource_profile_changes.begin(), resource_profile_changes.end()),
+                        resource_profile_changes.end()
+                    );
                 }
             }
 
-            sort(eligibles.begin(), eligibles.end(), [&](int a, int b) {
-                return nodes[a].priority_value < nodes[b].priority_value;
-            });
+            eligibles.erase(
+                remove(eligibles.begin(), eligibles.end(), selected_id),
+                eligibles.end()
+            );
 
-            for (int node_id : eligibles) {
-                node& curr_node = nodes[node_id];
-                bool can_schedule = true;
+            for (int succ_id : selected_node.successors) {
+                const node &succ = nodes[succ_id];
 
-                if (current_time + curr_node.duration_time > horizon) {
-                    can_schedule = false; 
-                } else {
-                    for (int k = 0; k < number_of_renewable_resources; k++) {
-                        for (int t = current_time; t < current_time + curr_node.duration_time; t++) {
-                            if (curr_node.renewable_resource_requirements[k] > matriz_recurso_kt[k][t]) {
-                                can_schedule = false;
-                                break;
-                            }
-                        }
-                        if (!can_schedule) break;
+                bool all_preds_scheduled = true;
+                for (int pred_id : succ.predecessors) {
+                    if (!ctx.scheduled[pred_id]) {
+                        all_preds_scheduled = false;
+                        break;
                     }
                 }
 
-                if (can_schedule) {
-                    curr_node.scheduled = true;
-                    curr_node.start_time = current_time;
-                    curr_node.finish_time = current_time + curr_node.duration_time;
-                    
-                    for (int k = 0; k < number_of_renewable_resources; k++) {
-                        for (int t = current_time; t < current_time + curr_node.duration_time; t++) {
-                            matriz_recurso_kt[k][t] -= curr_node.renewable_resource_requirements[k];
-                        }
-                    }
-
-                    active_jobs.push_back(node_id);
-                    scheduled_count++;
+                if (all_preds_scheduled && !ctx.scheduled[succ_id] &&
+                    find(eligibles.begin(), eligibles.end(), succ_id) == eligibles.end()) {
+                    eligibles.push_back(succ_id);
                 }
             }
 
-            // Se agendamos tudo, sair
-            if (scheduled_count == number_of_jobs) break;
-
+            sort(eligibles.begin(), eligibles.end(), [&](int a, int b){
+                return priority[a] < priority[b];
+            });
+        }
+
+        int best = -1;
+        for (int finish : ctx.finish_time) {
+            best = max(best, finish);
+        }
+        return best;
+    }
+
+    /**
+     * @brief Parallel Schedule Generation Scheme (SGS), guiado por eventos.
+     * Constrói um cronograma iterando sobre o tempo. Em cada ponto de decisão (t),
+     * tenta agendar o máximo de atividades elegíveis possível respeitando os recursos,
+     * na ordem da activity_list. Quando nada mais cabe em (t), salta direto para o
+     * próximo término de uma atividade em andamento.
+     * * Nada é varrido a cada instante: contadores de predecessores restantes
+     * liberam os sucessores quando o último predecessor termina, os elegíveis
+     * ficam ordenados pela posição na lista (os liberados em cada instante são
+     * intercalados neles) e os términos pendentes ficam num min-heap. Dentro de
+     * um instante os recursos só diminuem, então quando uma atividade não cabe
+     * toda a sua classe, e as classes com demanda e duração maiores ou iguais,
+     * são descartadas sem consultar o perfil; a varredura para quando nenhuma
+     * classe presente pode mais caber.
+     * * Produz exatamente o cronograma de parallel_SGS_reference, inclusive no
+     * caso de duração zero: os sucessores de uma atividade de duração zero
+     * iniciada em t só ficam elegíveis no próximo ponto de decisão (t + 1 se não
+     * houver término pendente).
+     * * Não altera o project: todo o estado fica em ctx, que ao final contém o
+     * cronograma (ctx.start_time / ctx.finish_time). Usa a versão
+     * especializada para o número de recursos da instância (select_decoders).
+     * @return double O makespan do cronograma gerado (2 * horizon se estourar o horizonte).
+     */
+    double parallel_SGS(const int *activity_list, evaluation_context &ctx) const {
+        return (this->*decoders.parallel)(activity_list, ctx);
+    }
+
+    /**
+     * @brief parallel_SGS com K recursos fixo em tempo de compilação (K = 0:
+     * número de recursos lido da instância). Com K fixo, os laços sobre os
+     * recursos no perfil são desenrolados.
+     */
+    template <int K> double parallel_SGS_fixed(const int *activity_list, evaluation_context &ctx) const {
+        ctx.reset(activity_list, number_of_jobs, renewable_resource_availability);
+        if (nodes.empty()) return 0;
+
+        const vector<int> &position = ctx.priority_value;
+        resource_profile &profile = ctx.profile;
+
+        vector<int> &remaining_predecessors = ctx.remaining_predecessors;
+        vector<int> &ready = ctx.eligibles;               // posições na lista, em ordem crescente
+        vector<int> &released = ctx.released;             // posições liberadas neste instante
+        vector<int> &zero_duration_finished = ctx.active_jobs;
+        vector<pair<int, int>> &finish_events = ctx.finish_events;
+        remaining_predecessors = number_of_predecessors;
+
+        // Classes com elegíveis em ready e carimbo do ponto de decisão em que
+        // cada classe foi rejeitada.
+        vector<int> &ready_per_class = ctx.ready_per_class;
+        vector<unsigned int> &rejected_stamp = ctx.rejected_stamp;
+        ready_per_class.assign(dominated_classes.size(), 0);
+        rejected_stamp.assign(dominated_classes.size(), 0);
+        unsigned int decision_point = 0;
+        int live_classes = 0;
+
+        // Uma atividade disjuntiva com alguma em execução não cabe: é
+        // rejeitada sem consultar o perfil.
+        vector<int> &running_conflicts = ctx.running_conflicts;
+        const bool track_conflicts = preprocessing.disjunctive_pairs > 0;
+        if (track_conflicts) running_conflicts.assign(dominated_classes.size(), 0);
+
+        auto release_successors = [&](int node_id) {
+            for (int succ_id : compact.successors[node_id]) {
+                if (--remaining_predecessors[succ_id] == 0 && !ctx.scheduled[succ_id]) {
+                    released.push_back(position[succ_id]);
+                }
+            }
+        };
+
+        // O nó fonte (índice 0) começa agendado em t = 0 e libera seus
+        // sucessores já no primeiro ponto de decisão.
+        ctx.start_time[0] = 0;
+        ctx.finish_time[0] = 0;
+        ctx.scheduled[0] = true;
+        release_successors(0);
+        for (int id = 1; id < number_of_jobs; ++id) {
+            if (number_of_predecessors[id] == 0) released.push_back(position[id]);
+        }
+
+        int scheduled_count = 1; // já contamos o nó fonte
+        int current_time = 0;
+        int makespan = 0;
+        auto later_finish = [](const pair<int, int> &a, const pair<int, int> &b) { return a.first > b.first; };
+
+        while (scheduled_count < number_of_jobs) {
+
+            if (current_time >= horizon) {
+                return (double)horizon * 2.0;
+            }
+
+            // Eventos até t: términos do heap e atividades de duração zero
+            // iniciadas no ponto de decisão anterior.
+            while (!finish_events.empty() && finish_events.front().first <= current_time) {
+                int node_id = finish_events.front().second;
+                pop_heap(finish_events.begin(), finish_events.end(), later_finish);
+                finish_events.pop_back();
+                if (track_conflicts) disjunctive_classes.add_to_partners(job_class[node_id], running_conflicts, -1);
+                release_successors(node_id);
+            }
+            for (int node_id : zero_duration_finished) release_successors(node_id);
+            zero_duration_finished.clear();
+
+            if (!released.empty()) {
+                for (int pos : released) {
+                    if (ready_per_class[job_class[activity_list[pos]]]++ == 0) live_classes++;
+                }
+                sort(released.begin(), released.end());
+                size_t old_size = ready.size();
+                ready.insert(ready.end(), released.begin(), released.end());
+                inplace_merge(ready.begin(), ready.begin() + old_size, ready.end());
+                released.clear();
+            }
+
+            // Tenta cada elegível em ordem; os que não cabem permanecem em ready.
+            // Quando todas as classes presentes já foram rejeitadas neste
+            // instante, o restante da lista não cabe e é mantido como está.
+            ++decision_point;
+            int rejected_classes = 0;
+            size_t kept = 0;
+            size_t r = 0;
+            for (; r < ready.size() && rejected_classes < live_classes; ++r) {
+                int node_id = activity_list[ready[r]];
+                int node_class = job_class[node_id];
+                if (rejected_stamp[node_class] == decision_point) {
+                    ready[kept++] = ready[r];
+                    continue;
+                }
+
+                int duration = compact.duration(node_id);
+                const int *requirements = request_row<K>(node_id);
+                if (current_time + duration > horizon || (track_conflicts && running_conflicts[node_class] > 0) ||
+                    !profile.fits<K>(current_time, duration, requirements)) {
+                    for (int c : dominated_classes[node_class]) {
+                        if (rejected_stamp[c] != decision_point) {
+                            rejected_stamp[c] = decision_point;
+                            if (ready_per_class[c] > 0) rejected_classes++;
+                        }
+                    }
+                    ready[kept++] = ready[r];
+                    continue;
+                }
+
+                ctx.scheduled[node_id] = true;
+                ctx.start_time[node_id] = current_time;
+                ctx.finish_time[node_id] = current_time + duration;
+                makespan = max(makespan, ctx.finish_time[node_id]);
+                profile.book<K>(current_time, duration, requirements);
+                scheduled_count++;
+                if (--ready_per_class[node_class] == 0) live_classes--;
+
+                ctx.makespan_bound = max(ctx.makespan_bound, ctx.finish_time[node_id] + critical_tail[node_id]);
+                if (ctx.makespan_bound > ctx.cutoff) {
+                    ctx.skipped_activities += number_of_jobs - scheduled_count;
+                    return rejected_fitness;
+                }
+
+                if (duration > 0) {
+                    finish_events.emplace_back(ctx.finish_time[node_id], node_id);
+                    push_heap(finish_events.begin(), finish_events.end(), later_finish);
+                    if (track_conflicts) disjunctive_classes.add_to_partners(node_class, running_conflicts, 1);
+                } else {
+                    zero_duration_finished.push_back(node_id);
+                }
+            }
+            kept = copy(ready.begin() + r, ready.end(), ready.begin() + kept) - ready.begin();
+            ready.resize(kept);
+
+            // Se agendamos tudo, sair
+            if (scheduled_count == number_of_jobs) break;
+
+            // Avançar o Tempo (Time Advance). Sem atividades em andamento nem
+            // pendentes, o perfil está livre daqui em diante: quem não coube
+            // agora nunca caberá (ou há um ciclo), e o horizonte estoura.
+            if (!finish_events.empty()) {
+                current_time = finish_events.front().first;
+            } else if (!zero_duration_finished.empty()) {
+                current_time++;
+            } else {
+                return (double)horizon * 2.0;
+            }
+        }
+
+        return makespan;
+    }
+
+    /**
+     * @brief Versão original do parallel SGS (varre todos os nós a cada ponto
+     * de decisão e avança o tempo de uma unidade quando nada está em andamento).
+     * Mantida como referência de corretude e desempenho para --bench sgs.
+     */
+    double parallel_SGS_reference(const int *activity_list, evaluation_context &ctx) const {
+        ctx.reset(activity_list, number_of_jobs, renewable_resource_availability);
+
+        const vector<int> &priority = ctx.priority_value;
+        resource_profile &profile = ctx.profile;
+
+        // Marcar o nó fonte (job 1, index 0) como já agendado no tempo 0.
+        // Sem isso, o laço de elegíveis nunca irá considerar sucessores do
+        // nó fonte porque sua finish_time inicialmente é -1, levando o
+        // algoritmo a avançar o tempo até o horizonte sem agendar nada.
+        if (!nodes.empty()) {
+            ctx.start_time[0] = 0;
+            ctx.finish_time[0] = 0;
+            ctx.scheduled[0] = true;
+        }
+
+        int scheduled_count = 1; // já contamos o nó fonte
+        int current_time = 0;
+
+        vector<int> &active_jobs = ctx.active_jobs;
+        vector<int> &eligibles = ctx.eligibles;
+
+        while (scheduled_count < number_of_jobs) {
+            
+            if (current_time >= horizon) {
+                return (double)horizon * 2.0;
+            }
+
+            eligibles.clear();
+
+            for (const auto& node : nodes) {
+                if (!ctx.scheduled[node.id]) {
+                    bool predecessors_finished = true;
+                    for (int pred_id : node.predecessors) {
+                        if (ctx.finish_time[pred_id] == -1 || ctx.finish_time[pred_id] > current_time) {
+                            predecessors_finished = false;
+                            break;
+                        }
+                    }
+                    if (predecessors_finished) {
+                        eligibles.push_back(node.id);
+                    }
+                }
+            }
+
+            sort(eligibles.begin(), eligibles.end(), [&](int a, int b) {
+                return priority[a] < priority[b];
+            });
+
+            for (int node_id : eligibles) {
+                const node& curr_node = nodes[node_id];
+                bool can_schedule = true;
+
+                if (current_time + curr_node.duration_time > horizon) {
+                    can_schedule = false; 
+                } else {
+                    can_schedule = profile.fits(current_time, curr_node.duration_time,
+                                                curr_node.renewable_resource_requirements.data());
+                }
+
+                if (can_schedule) {
+                    ctx.scheduled[node_id] = true;
+                    ctx.start_time[node_id] = current_time;
+                    ctx.finish_time[node_id] = current_time + curr_node.duration_time;
+                    
+                    profile.book(current_time, curr_node.duration_time,
+                                 curr_node.renewable_resource_requirements.data());
+
+                    active_jobs.push_back(node_id);
+                    scheduled_count++;
+                }
+            }
+
+            // Se agendamos tudo, sair
+            if (scheduled_count == number_of_jobs) break;
+
             // Avançar o Tempo (Time Advance)
             int next_time = horizon + 1; // Valor sentinela maior que horizonte
             bool found_next = false;
             
             // Limpa jobs ativos que já terminaram e busca o próximo salto de tempo
             for (auto it = active_jobs.begin(); it != active_jobs.end(); ) {
-                int job_finish = nodes[*it].finish_time;
+                int job_finish = ctx.finish_time[*it];
                 
                 if (job_finish > current_time) {
                     if (job_finish < next_time) {
@@ -847,139 +2269,1100 @@ struct project {
 
         // Calcular Fitness (Makespan)
         int max_finish = 0;
-        for (const auto& node : nodes) {
-            if (node.finish_time > max_finish) {
-                max_finish = node.finish_time;
+        for (int finish : ctx.finish_time) {
+            if (finish > max_finish) {
+                max_finish = finish;
+            }
+        }
+        return max_finish;
+    }
+
+    /**
+     * @brief Decodifica o indivíduo de um slot com o SGS escolhido e copia o
+     * cronograma resultante de ctx para os vetores planos do slot. Com o serial
+     * SGS e checkpoints ativos, retoma do prefixo compartilhado com o pai.
+     * * cutoff: se o limitante do makespan parcial (maior término + cauda
+     * crítica de uma tarefa já agendada) passar deste valor, a decodificação é
+     * abandonada e o slot recebe rejected_fitness; o cronograma do slot fica
+     * incompleto. Um filho pior que o pior membro nunca sobrevive à redução,
+     * então o pior fitness da população é um corte seguro.
+     * * Com o cache de fitness ativo, uma lista já decodificada recebe o
+     * fitness guardado e o cronograma fica pendente (schedule_pending) até
+     * alguém precisar dele (extract_individual). Como a decodificação rejeita
+     * exatamente as listas com makespan acima do corte, o acerto aplica o mesmo
+     * corte e o GA segue idêntico com ou sem cache.
+     * * Com a canonização, a entrada liga a lista de entrada à lista final (já
+     * canônica e, com a quebra de simetria, renumerada), que o acerto copia no
+     * slot; as listas intermediárias não entram no cache.
+     * * Se population.justify[slot] estiver marcado, o cronograma completo
+     * passa pelo forward_backward_improvement. O cache guarda o makespan da
+     * decodificação simples, então esses slots sempre são decodificados; a
+     * lista justificada só entra no cache com o serial SGS, o único que
+     * garante reproduzi-la.
+     */
+    void evaluate(population_storage &population, int slot, sgs_function sgs, evaluation_context &ctx,
+                  double cutoff = rejected_fitness) const {
+        const int *list = population.activity_list(slot);
+        if (break_symmetry) symmetry.relabel(population.activity_list(slot), number_of_jobs, ctx.symmetry_target);
+        population.schedule_pending[slot] = 0;
+        population.justified[slot] = 0;
+
+        // slots justificados também inserem a lista de entrada, então precisam da chave
+        uint64_t key = cache.enabled() ? cache.hash(list) : 0;
+        if (cache.enabled() && !population.justify[slot]) {
+            ctx.cache_lookups++;
+            double cached;
+            ctx.cache_key_list.resize(number_of_jobs);
+            if (cache.find(key, list, cached, ctx.cache_key_list.data())) {
+                ctx.cache_hits++;
+                population.fitness[slot] = cached > cutoff ? rejected_fitness : cached;
+                // como na decodificação, um corte deixa a lista sem canonizar
+                if (canonicalize && cached <= cutoff) {
+                    copy(ctx.cache_key_list.begin(), ctx.cache_key_list.end(), population.activity_list(slot));
+                }
+                population.schedule_pending[slot] = 1;
+                population.checkpoints.invalidate(slot);
+                population.checkpoints.reused_positions[slot] = 0;
+                return;
+            }
+        }
+
+        ctx.cutoff = cutoff < INT_MAX ? (int)floor(cutoff) : INT_MAX;
+        ctx.decodes++;
+        auto decode_start = cache.enabled() ? chrono::steady_clock::now() : chrono::steady_clock::time_point();
+
+        if (sgs == &project::serial_SGS && population.checkpoints.enabled()) {
+            population.fitness[slot] = serial_SGS_checkpointed(population, slot, ctx);
+        } else {
+            population.fitness[slot] = (this->*sgs)(list, ctx);
+        }
+        if (population.fitness[slot] == rejected_fitness) ctx.rejected_decodes++;
+        ctx.cutoff = INT_MAX;
+
+        // Só makespans exatos entram no cache (nem cortes nem a penalidade de inviável)
+        double fitness = population.fitness[slot];
+        bool complete = fitness != rejected_fitness && fitness != (double)horizon * 2.0;
+        bool cacheable = cache.enabled() && complete;
+        if (cache.enabled()) {
+            ctx.decode_ns += chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - decode_start).count();
+            if (cacheable && canonicalize) {
+                // a lista do slot vai ser reescrita: a chave é inserida ao final
+                ctx.cache_key_list.assign(list, list + number_of_jobs);
+            } else if (cacheable) {
+                cache.insert(key, list, fitness);
+            }
+        }
+        if (complete && population.justify[slot]) {
+            population.justified[slot] = 1;
+            if (forward_backward_improvement(population, slot, ctx)) {
+                cacheable = cacheable && sgs == &project::serial_SGS;
+                if (cacheable && !canonicalize) cache.insert(cache.hash(list), list, population.fitness[slot]);
+            }
+        }
+        if (canonicalize && complete) {
+            canonicalize_slot(population, slot, ctx);
+            // o FBI e a canonização reordenam a lista e podem desfazer a ordem dos pacientes
+            if (break_symmetry) break_symmetry_slot(population, slot, ctx);
+            // a lista de entrada de um slot justificado decodifica num makespan maior que o final
+            if (cacheable && !population.justified[slot]) {
+                cache.insert(key, ctx.cache_key_list.data(), fitness, list);
+            }
+            // a lista canônica é a sua própria forma canônica (a renumeração
+            // dos pacientes não garante isso)
+            if (cacheable && !break_symmetry) cache.insert(cache.hash(list), list, population.fitness[slot], list);
+        } else if (break_symmetry && complete && break_symmetry_slot(population, slot, ctx) && cacheable) {
+            cache.insert(cache.hash(list), list, population.fitness[slot]);
+        }
+
+        copy(ctx.start_time.begin(), ctx.start_time.end(), population.start_times(slot));
+        copy(ctx.finish_time.begin(), ctx.finish_time.end(), population.finish_times(slot));
+    }
+
+    /**
+     * @brief Reescreve a lista do slot na ordem dos inícios do cronograma em
+     * ctx (empates pela ordem topológica), a forma canônica do cronograma:
+     * listas diferentes que geram o mesmo cronograma ficam iguais.
+     * * A ordem continua viável em precedência (um predecessor termina antes
+     * do início do sucessor, e com duração zero o empate segue a ordem
+     * topológica) e, decodificada de novo, reproduz o mesmo cronograma com os
+     * dois SGS; por isso fitness e cronograma do slot não mudam. Os
+     * checkpoints do slot eram do prefixo da lista antiga e são descartados.
+     * @return bool Verdadeiro se a lista mudou.
+     */
+    bool canonicalize_slot(population_storage &population, int slot, evaluation_context &ctx) const {
+        vector<int> &order = ctx.canonical_order;
+        order.resize(number_of_jobs);
+        iota(order.begin(), order.end(), 0);
+        const vector<int> &start = ctx.start_time;
+        sort(order.begin(), order.end(), [&](int a, int b) {
+            if (start[a] != start[b]) return start[a] < start[b];
+            return topological_rank[a] < topological_rank[b];
+        });
+
+        int *list = population.activity_list(slot);
+        if (equal(order.begin(), order.end(), list)) return false;
+
+        copy(order.begin(), order.end(), list);
+        population.checkpoints.invalidate(slot);
+        return true;
+    }
+
+    /**
+     * @brief Quebra de simetria entre pacientes idênticos: renumera os
+     * pacientes de cada grupo pela ordem em que aparecem na lista do slot
+     * (patient_symmetry::relabel) e leva o cronograma em ctx junto.
+     * * Das até N! listas que só diferem pela troca de pacientes, a população
+     * guarda uma; pais alinhados fazem o crossover combinar o mesmo paciente
+     * dos dois lados, e listas simétricas caem na mesma entrada do cache e na
+     * mesma forma para a deduplicação. evaluate aplica a renumeração antes de
+     * decodificar (população inicial e filhos do crossover e da mutação) e de
+     * novo depois do FBI e da canonização. Fitness não muda.
+     * @return bool Verdadeiro se a lista mudou.
+     */
+    bool break_symmetry_slot(population_storage &population, int slot, evaluation_context &ctx) const {
+        vector<int> &target = ctx.symmetry_target;
+        if (!symmetry.relabel(population.activity_list(slot), number_of_jobs, target)) return false;
+
+        ctx.original_start.swap(ctx.start_time);
+        ctx.original_finish.swap(ctx.finish_time);
+        ctx.start_time.resize(number_of_jobs);
+        ctx.finish_time.resize(number_of_jobs);
+        for (int j = 0; j < number_of_jobs; ++j) {
+            int image = symmetry.image(j, target);
+            ctx.start_time[image] = ctx.original_start[j];
+            ctx.finish_time[image] = ctx.original_finish[j];
+        }
+        population.checkpoints.invalidate(slot);
+        return true;
+    }
+
+    /**
+     * @brief Avalia os slots indicados, em paralelo se o pool tiver mais de
+     * uma thread.
+     * * Cada thread usa o seu próprio evaluation_context e cada slot é
+     * escrito apenas pela thread que o avaliou. A decodificação é determinística
+     * e toda a aleatoriedade do GA é consumida fora daqui, na thread principal,
+     * então o resultado não depende do número de threads.
+     * * Só os primeiros limit slots (todos, se limit < 0) são decodificados, e
+     * nenhum depois do deadline; os demais são descartados (skip_evaluation).
+     * @return int Quantos slots foram decodificados.
+     */
+    int evaluate_population(population_storage &population, const vector<int> &slots, sgs_function sgs,
+                            double cutoff = rejected_fitness,
+                            solve_monitor::clock::time_point deadline = solve_monitor::clock::time_point::max(),
+                            long long limit = -1) {
+        int count = limit < 0 ? (int)slots.size() : (int)min<long long>(limit, (long long)slots.size());
+        for (int i = count; i < (int)slots.size(); ++i) skip_evaluation(population, slots[i]);
+
+        if (pool.size() == 1) {
+            int decoded = 0;
+            for (int i = 0; i < count; ++i) {
+                decoded += evaluate_before(population, slots[i], sgs, context, cutoff, deadline);
+            }
+            return decoded;
+        }
+
+        worker_contexts.resize(pool.size());
+        atomic<int> decoded(0);
+        pool.parallel_for(count, [&](int i, int worker) {
+            if (evaluate_before(population, slots[i], sgs, worker_contexts[worker], cutoff, deadline)) {
+                decoded.fetch_add(1, memory_order_relaxed);
+            }
+        });
+        return decoded.load();
+    }
+
+    /**
+     * @brief evaluate() se o deadline ainda não passou (uma leitura do relógio
+     * por decodificação); senão descarta o slot. Slots marcados em
+     * population.justify ignoram o corte: o FBI pode levar abaixo do pior membro
+     * um filho cuja decodificação simples passa dele.
+     * @return bool Verdadeiro se o slot foi decodificado.
+     */
+    bool evaluate_before(population_storage &population, int slot, sgs_function sgs, evaluation_context &ctx,
+                         double cutoff, solve_monitor::clock::time_point deadline) const {
+        if (deadline != solve_monitor::clock::time_point::max() && solve_monitor::clock::now() >= deadline) {
+            skip_evaluation(population, slot);
+            return false;
+        }
+        evaluate(population, slot, sgs, ctx, population.justify[slot] ? rejected_fitness : cutoff);
+        return true;
+    }
+
+    /// @brief Marca um filho não avaliado (fora do orçamento): perde na redução.
+    void skip_evaluation(population_storage &population, int slot) const {
+        population.fitness[slot] = rejected_fitness;
+        population.checkpoints.invalidate(slot);
+    }
+
+    /// @brief Corte para os filhos da próxima geração: o pior membro atual.
+    double offspring_cutoff(const population_storage &pop) const {
+        return early_abort ? pop.fitness[pop.worst()] : rejected_fitness;
+    }
+
+    /**
+     * @brief Marca quais slots a próxima avaliação justifica (modos offspring
+     * e probability). Os sorteios usam o gerador da thread principal (ou da
+     * ilha), como o resto do GA.
+     */
+    void request_justification(population_storage &population, const vector<int> &slots,
+                               const solve_options &options, mt19937 &generator) const {
+        bernoulli_distribution draw(options.justification_probability);
+        for (int slot : slots) {
+            switch (options.justification) {
+                case justification_mode::offspring: population.justify[slot] = 1; break;
+                case justification_mode::probability: population.justify[slot] = draw(generator); break;
+                default: population.justify[slot] = 0; break;
+            }
+        }
+    }
+
+    /**
+     * @brief Modo elites: justifica os count melhores membros que ainda não
+     * passaram pelo FBI. Roda na thread principal (ou da ilha) antes da
+     * redução, que reordena os melhorados e atualiza o incumbente.
+     */
+    void justify_elites(population_storage &population, int count, evaluation_context &ctx) const {
+        count = min(count, (int)population.members.size());
+        for (int i = 0; i < count; ++i) {
+            int slot = population.members[i];
+            double fitness = population.fitness[slot];
+            if (population.justified[slot] || fitness == rejected_fitness || fitness == (double)horizon * 2.0) continue;
+            population.justified[slot] = 1;
+
+            int *list = population.activity_list(slot);
+            if (population.schedule_pending[slot]) {
+                (this->*active_sgs)(list, ctx);
+                population.schedule_pending[slot] = 0;
+            } else {
+                ctx.start_time.assign(population.start_times(slot), population.start_times(slot) + number_of_jobs);
+                ctx.finish_time.assign(population.finish_times(slot), population.finish_times(slot) + number_of_jobs);
+            }
+
+            if (forward_backward_improvement(population, slot, ctx)) {
+                if (canonicalize) canonicalize_slot(population, slot, ctx);
+                if (cache.enabled() && active_sgs == &project::serial_SGS) {
+                    cache.insert(cache.hash(list), list, population.fitness[slot]);
+                }
+            }
+            copy(ctx.start_time.begin(), ctx.start_time.end(), population.start_times(slot));
+            copy(ctx.finish_time.begin(), ctx.finish_time.end(), population.finish_times(slot));
+        }
+    }
+
+    /**
+     * @brief Soma nas estatísticas os contadores de avaliação dos contextos
+     * (corte antecipado e cache de fitness), imprime o resumo em log e zera os
+     * contadores.
+     */
+    void collect_evaluation_counters(vector<evaluation_context *> contexts, solve_statistics &statistics,
+                                     ostream &log) const {
+        long long decodes = 0, rejected = 0, skipped = 0, lookups = 0, hits = 0, decode_ns = 0;
+        long long justified = 0, improved = 0, gain = 0;
+        for (evaluation_context *ctx : contexts) {
+            decodes += ctx->decodes;
+            rejected += ctx->rejected_decodes;
+            skipped += ctx->skipped_activities;
+            lookups += ctx->cache_lookups;
+            hits += ctx->cache_hits;
+            decode_ns += ctx->decode_ns;
+            justified += ctx->justifications;
+            improved += ctx->justification_improvements;
+            gain += ctx->justification_gain;
+            ctx->decodes = ctx->rejected_decodes = ctx->skipped_activities = 0;
+            ctx->cache_lookups = ctx->cache_hits = ctx->decode_ns = 0;
+            ctx->justifications = ctx->justification_improvements = ctx->justification_gain = 0;
+        }
+        statistics.aborted_evaluations += rejected;
+        statistics.skipped_activities += skipped;
+        statistics.cache_lookups += lookups;
+        statistics.cache_hits += hits;
+        statistics.justifications += justified;
+        statistics.justification_improvements += improved;
+        if (decodes > 0) statistics.cache_saved_ms += hits * ((double)decode_ns / decodes) / 1e6;
+
+        if (early_abort && decodes > 0) {
+            log << "[GA] Corte antecipado: " << rejected << " de " << decodes << " avaliacoes abandonadas, "
+                 << skipped << " atividades nao decodificadas ("
+                 << round(1000.0 * skipped / ((double)decodes * number_of_jobs)) / 10.0 << "% do total)" << endl;
+        }
+        if (lookups > 0) {
+            log << "[GA] Cache de fitness: " << hits << " acertos em " << lookups << " consultas ("
+                 << round(1000.0 * hits / lookups) / 10.0 << "%), ~"
+                 << round(statistics.cache_saved_ms * 10.0) / 10.0 << " ms de decodificacao poupados" << endl;
+        }
+        if (justified > 0) {
+            log << "[GA] FBI: " << improved << " de " << justified << " cronogramas encurtados";
+            if (improved > 0) log << " (em media " << round(10.0 * gain / improved) / 10.0 << ")";
+            log << endl;
+        }
+    }
+
+    /**
+     * @brief Copia o indivíduo de um slot para um individual avulso (usado
+     * apenas para o incumbent e para o resultado final). Se o fitness veio do
+     * cache, o cronograma é decodificado agora.
+     */
+    individual extract_individual(const population_storage &population, int slot) const {
+        individual ind;
+        ind.fitness = population.fitness[slot];
+        ind.activity_list.assign(population.activity_list(slot), population.activity_list(slot) + number_of_jobs);
+        if (population.schedule_pending[slot]) {
+            evaluation_context ctx;
+            (this->*active_sgs)(population.activity_list(slot), ctx);
+            ind.start_times = ctx.start_time;
+            ind.finish_times = ctx.finish_time;
+            return ind;
+        }
+        ind.start_times.assign(population.start_times(slot), population.start_times(slot) + number_of_jobs);
+        ind.finish_times.assign(population.finish_times(slot), population.finish_times(slot) + number_of_jobs);
+        return ind;
+    }
+
+    /**
+     * @brief Ativa os checkpoints da população quando o decodificador é o
+     * serial SGS (o parallel SGS não tem estado que dependa só de um prefixo).
+     */
+    void configure_checkpoints(population_storage &pop, sgs_function sgs) const {
+        if (sgs != &project::serial_SGS || checkpoint_interval == 0) return;
+
+        int interval = checkpoint_interval > 0 ? checkpoint_interval : max(1, number_of_jobs / 8);
+        pop.checkpoints.configure(pop.capacity, number_of_jobs, interval);
+    }
+
+    /**
+     * @brief Fração das posições dos filhos da geração que não precisou ser
+     * decodificada graças aos checkpoints.
+     */
+    double reused_decoding_fraction(const population_storage &pop) const {
+        if (!pop.checkpoints.enabled() || pop.offspring.empty()) return 0.0;
+
+        long long reused = 0;
+        for (int slot : pop.offspring) reused += pop.checkpoints.reused_positions[slot];
+        return (double)reused / ((double)pop.offspring.size() * number_of_jobs);
+    }
+
+    /**
+     * @brief Solve "anytime": roda o GA (uma população ou o modelo de ilhas)
+     * até o primeiro critério de parada de options ser atingido e devolve o
+     * melhor indivíduo junto com as estatísticas da execução. Também para
+     * quando o incumbente atinge o melhor limitante inferior (é ótimo).
+     */
+    solve_result solve(const solve_options &options) {
+        solve_result result;
+        solve_monitor monitor(options, result.statistics);
+        sgs_function sgs = options.sgs ? options.sgs : &project::parallel_SGS;
+        active_sgs = sgs;
+        // no máximo ~64 MB de listas guardadas
+        size_t cache_entries = min<size_t>(max(0, fitness_cache_size), ((size_t)64 << 20) / (sizeof(int) * number_of_jobs));
+        // com a canonização o acerto precisa devolver a lista canônica
+        cache.configure(number_of_jobs, canonicalize ? cache_entries / 2 : cache_entries, canonicalize);
+
+        compute_bounds(options.log_stream());
+        result.best = options.islands.islands > 1 ? run_islands(options, sgs, monitor)
+                                                  : run_population(options, sgs, monitor);
+
+        solve_statistics &stats = result.statistics;
+        stats.elapsed_ms = monitor.elapsed_ms();
+        stats.initialization_ms = initialization_time_ms;
+
+        ostream &log = options.log_stream();
+        log << "[GA] Parada: " << stop_reason_name(stats.reason) << " | geracoes: " << stats.generations
+             << " | avaliacoes: " << stats.evaluations << " | melhor em " << round(stats.best_found_ms * 10.0) / 10.0
+             << " ms (geracao " << stats.best_generation << ")" << endl;
+        log << "[GA] Algoritmo finalizado! Melhor fitness: " << result.best.fitness << endl;
+        return result;
+    }
+
+    /**
+     * @brief Constrói um cronograma repetindo o cronograma de poucos
+     * pacientes, para instâncias com muitos pacientes idênticos (ver
+     * cyclic_pattern.hpp). Não melhora o GA em poucos pacientes: a entrada e a
+     * saída do padrão custam cerca de um bloco.
+     * * Para k = 1..max_patients_per_pattern, monta o bloco de k cópias do
+     * paciente do maior grupo de symmetry. O GA (parallel e serial SGS, com
+     * evaluations_per_pattern avaliações cada) agenda o bloco, que é dobrado
+     * no menor período em que suas cópias cabem; a lista do GA e
+     * evaluations_per_pattern listas amostradas como na população inicial são
+     * então decodificadas direto em períodos menores
+     * (cyclic_pattern::periodic_serial_decode). Fica o candidato com o menor
+     * makespan previsto para os N pacientes do grupo: o maior entre o término
+     * da última cópia, que pode estar incompleta ((ceil(N / k) - 1) * período
+     * mais o término dos seus pacientes no bloco), e o da penúltima
+     * ((ceil(N / k) - 2) * período + makespan do bloco).
+     * * O paciente i do grupo recebe os inícios do paciente i % k do bloco
+     * deslocados de (i / k) * período. As atividades fora do grupo entram, em
+     * ordem topológica, no primeiro instante em que cabem; por fim cada
+     * atividade, na ordem dos inícios, é adiantada para o primeiro instante
+     * viável depois dos predecessores e do último início da sua classe
+     * (job_class) nesta passada. O cronograma nunca piora, e o ganho de cada
+     * paciente se acumula nos seguintes, o que corrige um período acima do
+     * ideal. Fora a busca nos blocos, que não depende de N, o custo acompanha
+     * o horizonte, não só o número de atividades: o perfil por instante
+     * (cyclic_pattern::time_indexed_profile) ocupa O(horizonte * K) e cada
+     * atividade custa O(duração * K) para entrar e para ser adiantada.
+     * @return pattern_result Com fitness infinito se a instância não tem
+     * pacientes idênticos (use o GA).
+     */
+    pattern_result solve_by_pattern(const pattern_options &options) {
+        pattern_result result;
+        auto start_clock = chrono::steady_clock::now();
+        auto elapsed_ms = [&]() {
+            return chrono::duration<double, milli>(chrono::steady_clock::now() - start_clock).count();
+        };
+        if (symmetry.empty()) return result;
+
+        auto group_size = [&](int g) { return symmetry.group_first[g + 1] - symmetry.group_first[g]; };
+        int group = 0;
+        for (int g = 1; g < symmetry.groups(); ++g) {
+            if (group_size(g) > group_size(group)) group = g;
+        }
+        int first_member = symmetry.group_first[group];
+        int patients = group_size(group);
+        int K = number_of_renewable_resources;
+
+        project patient;
+        patient.build_patient_instance(*this, first_member);
+        int activities = patient.number_of_jobs - 2;
+
+        // k pacientes ocupam cada recurso por pelo menos k * trabalho / capacidade
+        vector<long long> work(K, 0);
+        for (int j = 1; j <= activities; ++j) {
+            for (int k = 0; k < K; ++k) work[k] += (long long)patient.compact.duration(j) * patient.compact.request(j, k);
+        }
+
+        // --- Busca do bloco ---
+        long long best_prediction = LLONG_MAX;
+        vector<int> block_start;
+        for (int k = 1; k <= min(options.max_patients_per_pattern, patients); ++k) {
+            project block;
+            block.build_multi_patient_instance(patient, k);
+            int lowest = 1;
+            for (int r = 0; r < K; ++r) {
+                int capacity = renewable_resource_availability[r];
+                if (capacity > 0) lowest = (int)max<long long>(lowest, (k * work[r] + capacity - 1) / capacity);
+            }
+            int batches = (patients + k - 1) / k;
+            int last_patients = patients - (batches - 1) * k;
+
+            // menor período já obtido com este k
+            int block_period = INT_MAX;
+            auto consider = [&](const vector<int> &starts, int period, int makespan) {
+                block_period = min(block_period, period);
+                // pacientes da última cópia: atividades 1 .. last_patients * activities do bloco
+                int tail = 0;
+                for (int j = 1; j <= last_patients * activities; ++j) {
+                    tail = max(tail, starts[j] + block.compact.duration(j));
+                }
+                // a penúltima cópia, completa, pode terminar depois da última
+                long long prediction = (long long)(batches - 1) * period + tail;
+                if (batches >= 2) prediction = max(prediction, (long long)(batches - 2) * period + makespan);
+                if (prediction < best_prediction) {
+                    best_prediction = prediction;
+                    block_start = starts;
+                    result.patients_per_pattern = k;
+                    result.period = period;
+                    result.pattern_makespan = makespan;
+                }
+            };
+
+            for (sgs_function sgs : {&project::parallel_SGS, &project::serial_SGS}) {
+                solve_options block_options;
+                block_options.sgs = sgs;
+                block_options.max_generations = -1;
+                block_options.max_evaluations = options.evaluations_per_pattern;
+                block_options.log = nullptr;
+                block.set_seed((unsigned int)rng());
+                solve_result solved = block.solve(block_options);
+                result.evaluations += solved.statistics.evaluations;
+
+                // o cronograma do GA dobrado no menor período em que cabe...
+                const individual &b = solved.best;
+                int makespan = (int)b.fitness;
+                int period = cyclic_pattern::minimum_period(block.compact, renewable_resource_availability,
+                                                            b.start_times, makespan, lowest);
+                consider(b.start_times, period, makespan);
+
+                // ...e a mesma lista decodificada direto em cada período menor
+                vector<int> starts;
+                for (int shorter = lowest; shorter < period; ++shorter) {
+                    int length = cyclic_pattern::periodic_serial_decode(
+                        block.compact, renewable_resource_availability, b.activity_list.data(), shorter, starts);
+                    if (length >= 0) consider(starts, shorter, length);
+                }
+            }
+
+            // listas amostradas, do menor período para cima até alguma caber
+            population_storage samples;
+            samples.allocate((int)max(1LL, options.evaluations_per_pattern), 0, block.number_of_jobs);
+            block.create_initial_population(samples, block.rng);
+            vector<int> starts;
+            for (int shorter = lowest; shorter < block_period; ++shorter) {
+                bool found = false;
+                for (int slot : samples.members) {
+                    int length = cyclic_pattern::periodic_serial_decode(
+                        block.compact, renewable_resource_availability, samples.activity_list(slot), shorter, starts);
+                    result.evaluations++;
+                    if (length < 0) continue;
+                    consider(starts, shorter, length);
+                    found = true;
+                }
+                if (found) break;
+            }
+        }
+        result.search_ms = elapsed_ms();
+        result.tiled_patients = patients;
+
+        // --- Ladrilhamento ---
+        int k = result.patients_per_pattern;
+        vector<int> start(number_of_jobs, 0), finish(number_of_jobs, 0);
+        vector<char> placed(number_of_jobs, 0);
+        cyclic_pattern::time_indexed_profile profile;
+        profile.reset(renewable_resource_availability, (int)best_prediction);
+        auto request = [&](int j) { return request_rows.data() + (size_t)j * K; };
+
+        for (int i = 0; i < patients; ++i) {
+            int member = first_member + i;
+            int shift = (i / k) * result.period;
+            int block_offset = (i % k) * activities;
+            for (int l = 0; l < activities; ++l) {
+                int j = symmetry.member_nodes[symmetry.member_offset[member] + l];
+                start[j] = shift + block_start[block_offset + l + 1];
+                finish[j] = start[j] + compact.duration(j);
+                profile.book(start[j], compact.duration(j), request(j));
+                placed[j] = 1;
+            }
+        }
+
+        auto release_time = [&](int j) {
+            int earliest = 0;
+            for (int p : compact.predecessors[j]) {
+                if (p != j) earliest = max(earliest, finish[p]);
+            }
+            return earliest;
+        };
+
+        // --- Reparo: atividades fora do grupo ---
+        vector<int> order(number_of_jobs);
+        iota(order.begin(), order.end(), 0);
+        sort(order.begin(), order.end(), [&](int a, int b) { return topological_rank[a] < topological_rank[b]; });
+        for (int j : order) {
+            if (placed[j]) continue;
+            int duration = compact.duration(j);
+            start[j] = profile.earliest_fit(release_time(j), -1, duration, request(j));
+            finish[j] = start[j] + duration;
+            profile.book(start[j], duration, request(j));
+        }
+
+        // --- Compactação: cada atividade no primeiro instante viável ---
+        auto by_start = [&](int a, int b) {
+            return start[a] != start[b] ? start[a] < start[b] : topological_rank[a] < topological_rank[b];
+        };
+        sort(order.begin(), order.end(), by_start);
+        // sem o último início da classe, as liberadas pelo source buscariam desde 0
+        vector<int> class_start(job_class.empty() ? 0 : *max_element(job_class.begin(), job_class.end()) + 1, 0);
+        for (int j : order) {
+            int duration = compact.duration(j);
+            profile.book(start[j], duration, request(j), -1);
+            int &last_start = class_start[job_class[j]];
+            int earliest = min(start[j], max(release_time(j), last_start));
+            start[j] = profile.earliest_fit(earliest, start[j], duration, request(j));
+            last_start = start[j];
+            finish[j] = start[j] + duration;
+            profile.book(start[j], duration, request(j));
+        }
+        sort(order.begin(), order.end(), by_start);
+
+        individual &best = result.best;
+        best.activity_list = order;
+        best.start_times = start;
+        best.finish_times = finish;
+        best.fitness = *max_element(finish.begin(), finish.end());
+        result.elapsed_ms = elapsed_ms();
+        return result;
+    }
+
+    individual solve_instance_via_ga(int pop_size, int generations, double mut_prob, sgs_function sgs) {
+        solve_options options;
+        options.pop_size = pop_size;
+        options.max_generations = generations;
+        options.mutation_probability = mut_prob;
+        options.sgs = sgs;
+        return solve(options).best;
+    }
+
+    individual solve_instance_via_islands(int pop_size, int generations, double mut_prob, sgs_function sgs,
+                                          const island_options &islands) {
+        solve_options options;
+        options.pop_size = pop_size;
+        options.max_generations = generations;
+        options.mutation_probability = mut_prob;
+        options.sgs = sgs;
+        options.islands = islands;
+        return solve(options).best;
+    }
+
+
+    
+    // --- Funções utilitárias para visualização do cronograma ---
+    int extract_num_patients_from_filename(const string &filename) {
+        // tenta encontrar um número antes da palavra 'pacientes' ou 'paciente' no nome do arquivo
+        size_t pos = filename.find("pacientes");
+        if (pos == string::npos) pos = filename.find("paciente");
+        if (pos == string::npos) return 0;
+
+        // procurar dígitos à esquerda
+        int i = (int)pos - 1;
+        while (i >= 0 && !isdigit((unsigned char)filename[i])) i--;
+        if (i < 0) return 0;
+        int j = i;
+        while (j >= 0 && isdigit((unsigned char)filename[j])) j--;
+
+        string num = filename.substr(j + 1, i - j);
+        try {
+            return stoi(num);
+        } catch (...) {
+            return 0;
+        }
+    }
+
+    void print_schedule_console(individual &ind, const string &instance_name) {
+        cout << "\n--- Cronograma para instância: " << instance_name << " ---" << endl;
+
+        int num_patients = extract_num_patients_from_filename(instance_name);
+        int total_real_activities = number_of_jobs - 2; // remover source/sink
+
+        if (num_patients > 0 && total_real_activities % num_patients == 0) {
+            int activities_per_patient = total_real_activities / num_patients;
+            vector<vector<tuple<int,int,int,int>>> by_patient(num_patients + 1);
+
+            for (int id = 0; id < (int)ind.start_times.size(); ++id) { // 0-based
+                if (id == 0 || id == number_of_jobs - 1) continue; // ignorar source/sink
+                int start = ind.start_times[id];
+                int finish = ind.finish_times[id];
+                int printed_id = id + 1; // para compatibilidade com parser (1-based)
+                int paciente_num = ((printed_id - 2) / activities_per_patient) + 1;
+                if (paciente_num < 1 || paciente_num > num_patients) paciente_num = 0;
+                if (paciente_num == 0) continue;
+                by_patient[paciente_num].push_back(make_tuple(printed_id, start, finish, nodes[id].duration_time));
+            }
+
+            for (int p = 1; p <= num_patients; ++p) {
+                cout << "\nPaciente " << p << ":" << endl;
+                auto &list = by_patient[p];
+                sort(list.begin(), list.end(), [](const tuple<int,int,int,int> &a, const tuple<int,int,int,int> &b){
+                    return get<1>(a) < get<1>(b);
+                });
+                for (auto &t : list) {
+                    cout << "  Atividade " << get<0>(t) << " | Inicia: " << get<1>(t) << " | Termina: " << get<2>(t) << " | Dur: " << get<3>(t) << endl;
+                }
+            }
+        } else {
+            // fallback: imprime lista plana de tarefas com tempos
+            cout << "(Formato padrão) Jobs | Start | Finish | Dur" << endl;
+            for (int id = 0; id < (int)ind.start_times.size(); ++id) {
+                int start = ind.start_times[id];
+                int finish = ind.finish_times[id];
+                cout << "Job " << id + 1 << " | " << start << " | " << finish << " | " << nodes[id].duration_time << endl;
             }
         }
-        individual.fitness = max_finish;
+
+        cout << "--- Fim do cronograma ---\n" << endl;
+    }
+
+    private:
+    // --- Métodos Auxiliares Internos do project ---
+
+    /// @brief Laço do GA com uma única população (ver solve).
+    individual run_population(const solve_options &options, sgs_function sgs, solve_monitor &monitor) {
+        ostream &log = options.log_stream();
+        solve_statistics &stats = monitor.statistics;
+
+        population.allocate(options.pop_size, 2 * (options.pop_size / 2), number_of_jobs);
+        population.deduplicate = canonicalize;
+        configure_checkpoints(population, sgs);
+
+        auto initialization_start = chrono::steady_clock::now();
+        create_initial_population(population, rng);
+        initialization_time_ms = chrono::duration<double, milli>(chrono::steady_clock::now() - initialization_start).count();
+
+        individual best_global;
+
+        // Avaliação inicial; os slots livres ainda têm fitness infinito, então a
+        // redução apenas ordena os membros. O primeiro membro é sempre avaliado,
+        // para haver um incumbente; os outros respeitam o limite de tempo.
+        request_justification(population, population.members, options, rng);
+        evaluate(population, population.members[0], sgs, context);
+        vector<int> others(population.members.begin() + 1, population.members.end());
+        stats.evaluations += 1 + evaluate_population(population, others, sgs, rejected_fitness, monitor.deadline);
+        if (rank_and_reduce(population, best_global)) monitor.improved(best_global.fitness, 0);
+        log << "[GA] Avaliados " << population.members.size() << " individuos" << endl;
+
+        for (int g = 0; !monitor.should_stop(best_global.fitness, bounds.best(), g); ++g) {
+            crossover(population, rng);
+
+            log << "[GA]   Mutacao..." << endl;
+            mutate(population, options.mutation_probability, rng);
+            request_justification(population, population.offspring, options, rng);
+
+            stats.evaluations += evaluate_population(population, population.offspring, sgs, offspring_cutoff(population),
+                                                     monitor.deadline,
+                                                     monitor.evaluation_allowance(population.offspring.size()));
+            stats.generations = g + 1;
+            if (population.checkpoints.enabled()) {
+                log << "[GA]   Geracao " << g + 1 << ": decodificacao reaproveitada "
+                     << round(1000.0 * reused_decoding_fraction(population)) / 10.0 << "%" << endl;
+            }
+
+            if (options.justification == justification_mode::elites) {
+                justify_elites(population, options.justified_elites, context);
+            }
+            if (rank_and_reduce(population, best_global)) monitor.improved(best_global.fitness, g + 1);
+            if (canonicalize) {
+                monitor.diversity = stats.diversity = population.distinct_members();
+                log << "[GA]   Geracao " << g + 1 << ": " << stats.diversity << " de " << population.members.size()
+                     << " cronogramas distintos, " << population.last_duplicates << " repetidos descartados" << endl;
+            }
+        }
+        vector<evaluation_context *> contexts = {&context};
+        for (auto &ctx : worker_contexts) contexts.push_back(&ctx);
+        collect_evaluation_counters(contexts, stats, options.log_stream());
+
+        return best_global;
+    }
+
+    /**
+     * @brief Modelo de ilhas: N populações independentes evoluem em paralelo e
+     * trocam seus melhores indivíduos a cada migration_interval gerações.
+     * * Cada ilha tem população (pop_size), gerador e evaluation_context próprios
+     * e roda o laço crossover -> mutação -> redução sem sincronizar com as outras.
+     * As threads só se encontram na migração, feita na thread principal. As
+     * sementes das ilhas saem do gerador do project, então com a mesma semente o
+     * resultado não depende do número de threads.
+     * * Os critérios de parada são verificados a cada época (entre migrações);
+     * dentro dela cada ilha para sozinha pelo tempo, pelo limitante inferior ou
+     * pela sua parte do orçamento de avaliações, dividido igualmente entre as
+     * ilhas para não depender da ordem das threads.
+     */
+    individual run_islands(const solve_options &options, sgs_function sgs, solve_monitor &monitor) {
+        ostream &log = options.log_stream();
+        solve_statistics &stats = monitor.statistics;
+        int number_of_islands = max(1, options.islands.islands);
+
+        vector<population_storage> islands(number_of_islands);
+        vector<mt19937> island_rngs;
+        vector<evaluation_context> island_contexts(number_of_islands);
+
+        auto initialization_start = chrono::steady_clock::now();
+        for (int i = 0; i < number_of_islands; ++i) {
+            islands[i].allocate(options.pop_size, 2 * (options.pop_size / 2), number_of_jobs);
+            islands[i].deduplicate = canonicalize;
+            configure_checkpoints(islands[i], sgs);
+            create_initial_population(islands[i], rng);
+            island_rngs.emplace_back(rng());
+            request_justification(islands[i], islands[i].members, options, island_rngs[i]);
+        }
+        initialization_time_ms = chrono::duration<double, milli>(chrono::steady_clock::now() - initialization_start).count();
+
+        vector<double> reused_fraction(number_of_islands, 0.0);
+        vector<long long> budget(number_of_islands), island_evaluations(number_of_islands, 0);
+        vector<int> island_generations(number_of_islands);
+
+        // Como em run_population, o primeiro membro de cada ilha é sempre avaliado
+        pool.parallel_for(number_of_islands, [&](int i, int) {
+            const vector<int> &members = islands[i].members;
+            evaluate(islands[i], members[0], sgs, island_contexts[i]);
+            island_evaluations[i] = 1;
+            for (size_t k = 1; k < members.size(); ++k) {
+                island_evaluations[i] +=
+                    evaluate_before(islands[i], members[k], sgs, island_contexts[i], rejected_fitness, monitor.deadline);
+            }
+            islands[i].reduce();
+        });
+        stats.evaluations += accumulate(island_evaluations.begin(), island_evaluations.end(), 0LL);
+
+        individual best_global;
+        auto gather_best = [&](int generation) {
+            bool improved = false;
+            for (const auto &island : islands) {
+                if (island.fitness[island.best()] < best_global.fitness) {
+                    best_global = extract_individual(island, island.best());
+                    improved = true;
+                }
+            }
+            if (improved) monitor.improved(best_global.fitness, generation);
+        };
+        gather_best(0);
+
+        int interval = options.islands.migration_interval > 0 ? options.islands.migration_interval
+                       : options.max_generations > 0          ? options.max_generations
+                                                              : 1;
+
+        int g = 0;
+        while (!monitor.should_stop(best_global.fitness, bounds.best(), g)) {
+            int epoch = interval;
+            if (options.max_generations >= 0) epoch = min(epoch, options.max_generations - g);
+
+            long long remaining = monitor.evaluation_allowance(LLONG_MAX);
+            for (int i = 0; i < number_of_islands; ++i) {
+                budget[i] = remaining == LLONG_MAX ? LLONG_MAX
+                                                   : remaining / number_of_islands + (i < remaining % number_of_islands);
+            }
+
+            pool.parallel_for(number_of_islands, [&](int i, int) {
+                population_storage &island = islands[i];
+                reused_fraction[i] = 0.0;
+                island_evaluations[i] = 0;
+                island_generations[i] = 0;
+                for (int e = 0; e < epoch; ++e) {
+                    // as outras ilhas terminam a época; a parada geral é no laço externo
+                    if (bounds_computed && island.fitness[island.best()] == bounds.best()) break;
+                    if (island_evaluations[i] >= budget[i] || monitor.expired()) break;
+
+                    crossover(island, island_rngs[i]);
+                    mutate(island, options.mutation_probability, island_rngs[i]);
+                    request_justification(island, island.offspring, options, island_rngs[i]);
+                    double cutoff = offspring_cutoff(island);
+                    long long allowed = budget[i] - island_evaluations[i];
+                    for (int k = 0; k < (int)island.offspring.size(); ++k) {
+                        int slot = island.offspring[k];
+                        if (k >= allowed) {
+                            skip_evaluation(island, slot);
+                        } else {
+                            island_evaluations[i] +=
+                                evaluate_before(island, slot, sgs, island_contexts[i], cutoff, monitor.deadline);
+                        }
+                    }
+                    reused_fraction[i] += reused_decoding_fraction(island) / epoch;
+                    if (options.justification == justification_mode::elites) {
+                        justify_elites(island, options.justified_elites, island_contexts[i]);
+                    }
+                    island.reduce();
+                    island_generations[i]++;
+                }
+            });
+
+            g += *max_element(island_generations.begin(), island_generations.end());
+            stats.generations = g;
+            stats.evaluations += accumulate(island_evaluations.begin(), island_evaluations.end(), 0LL);
+            gather_best(g);
+
+            log << "[GA] Ilhas: geracao " << g;
+            if (options.max_generations >= 0) log << "/" << options.max_generations;
+            log << " | melhor fitness: " << best_global.fitness;
+            if (islands[0].checkpoints.enabled()) {
+                double mean = accumulate(reused_fraction.begin(), reused_fraction.end(), 0.0) / number_of_islands;
+                log << " | decodificacao reaproveitada " << round(1000.0 * mean) / 10.0 << "%";
+            }
+            if (canonicalize) {
+                // converge quando a ilha mais diversa convergir
+                stats.diversity = 0;
+                monitor.diversity = 0;
+                for (auto &island : islands) {
+                    int distinct = island.distinct_members();
+                    stats.diversity += distinct;
+                    monitor.diversity = max(monitor.diversity, distinct);
+                }
+                log << " | cronogramas distintos: " << stats.diversity << " de " << number_of_islands * options.pop_size;
+            }
+            log << endl;
+
+            if (options.islands.migration_interval > 0 && !monitor.should_stop(best_global.fitness, bounds.best(), g)) {
+                migrate(islands, options.islands);
+            }
+        }
+
+        vector<evaluation_context *> contexts;
+        for (auto &ctx : island_contexts) contexts.push_back(&ctx);
+        collect_evaluation_counters(contexts, stats, options.log_stream());
+
+        return best_global;
+    }
+
+    /**
+     * @brief Prepara ctx para o serial SGS: nó fonte agendado em t = 0 e o
+     * conjunto de términos (ctx.resource_profile_changes, ordenado) com o 0.
+     */
+    void start_serial_SGS(const int *activity_list, evaluation_context &ctx) const {
+        ctx.reset(activity_list, number_of_jobs, renewable_resource_availability);
+
+        ctx.start_time[0] = 0;
+        ctx.finish_time[0] = 0;
+        ctx.scheduled[0] = true;
+        ctx.resource_profile_changes.push_back(0);
+    }
+
+    /**
+     * @brief Agenda as atividades das posições [from, to) da lista, uma a uma,
+     * no primeiro término viável (ver serial_SGS).
+     * * Com backward, o grafo é percorrido ao contrário (os sucessores fazem o
+     * papel de predecessores e a cabeça crítica o da cauda) e os tempos em ctx
+     * ficam no eixo invertido (ver backward_SGS).
+     * @return decode_status infeasible se alguma atividade exige mais que a
+     * capacidade; rejected se o limitante passou de ctx.cutoff.
+     */
+    decode_status serial_SGS_positions(const int *activity_list, int from, int to, evaluation_context &ctx,
+                                       int &makespan, bool backward = false) const {
+        return (this->*decoders.serial_positions)(activity_list, from, to, ctx, makespan, backward);
     }
 
-    individual solve_instance_via_ga(int pop_size, int generations, double mut_prob, void (project::*sgs)(individual &)) {
+    /// @brief serial_SGS_positions com K recursos fixo (ver parallel_SGS_fixed).
+    template <int K>
+    decode_status serial_SGS_positions_fixed(const int *activity_list, int from, int to, evaluation_context &ctx,
+                                             int &makespan, bool backward) const {
+        resource_profile &profile = ctx.profile;
+        vector<int> &finish_times = ctx.resource_profile_changes; // ordenado, sem repetições
 
-        this->population.clear();
-        this->population = create_initial_population(pop_size);
+        for (int i = from; i < to; ++i) {
+            int node_id = activity_list[i];
+            if (ctx.scheduled[node_id]) continue;
 
-        individual best_global;
+            int duration = compact.duration(node_id);
+            const int *requirements = request_row<K>(node_id);
 
-        // Avaliação inicial
-        for (size_t i = 0; i < population.size(); ++i) {
-            auto &ind = population[i];
-            (this->*sgs)(ind);
-            // preencher mapas de tempos no indivíduo para posterior visualização
-            ind.start_times.clear(); ind.finish_times.clear();
-            for (const auto &nd : nodes) {
-                ind.start_times[nd.id] = nd.start_time;
-                ind.finish_times[nd.id] = nd.finish_time;
+            int current_t = 0;
+            for (int pred_id : backward ? compact.successors[node_id] : compact.predecessors[node_id]) {
+                current_t = max(current_t, ctx.finish_time[pred_id]);
             }
-            if (ind.fitness < best_global.fitness) best_global = ind;
-            if ((i + 1) % 10 == 0) cout << "[GA] Avaliado " << (i + 1) << "/" << population.size() << " individuos" << endl;
-        }
-
-        for (int g = 0; g < generations; ++g) {
-            vector<individual> off = crossover(population);
 
-            cout << "[GA]   Mutacao..." << endl;
-            off = mutate(off, mut_prob);
-
-            for (auto &ind : off) {
-                (this->*sgs)(ind);
-                ind.start_times.clear(); ind.finish_times.clear();
-                for (const auto &nd : nodes) {
-                    ind.start_times[nd.id] = nd.start_time;
-                    ind.finish_times[nd.id] = nd.finish_time;
-                }
+            int blocked_until;
+            while ((blocked_until = profile.first_violation_end<K>(current_t, duration, requirements)) >= 0) {
+                auto next = lower_bound(finish_times.begin(), finish_times.end(), max(blocked_until, current_t + 1));
+                if (next == finish_times.end()) return decode_status::infeasible;
+                current_t = *next;
             }
 
-            // Elitismo + Seleção (Rank and Reduce Simplificado)
-            population.insert(population.end(), off.begin(), off.end());
-            sort(population.begin(), population.end(), [](const individual &a, const individual &b) {
-                return a.fitness < b.fitness;
-            });
-            population.resize(pop_size);
+            int finish = current_t + duration;
+            ctx.scheduled[node_id] = true;
+            ctx.start_time[node_id] = current_t;
+            ctx.finish_time[node_id] = finish;
+            profile.book<K>(current_t, duration, requirements);
+            makespan = max(makespan, finish);
+
+            auto slot = lower_bound(finish_times.begin(), finish_times.end(), finish);
+            if (slot == finish_times.end() || *slot != finish) finish_times.insert(slot, finish);
 
-            if (population[0].fitness < best_global.fitness) {
-                best_global = population[0];
+            ctx.makespan_bound = max(ctx.makespan_bound, finish + (backward ? critical_head : critical_tail)[node_id]);
+            if (ctx.makespan_bound > ctx.cutoff) {
+                ctx.skipped_activities += number_of_jobs - 1 - i;
+                return decode_status::rejected;
             }
         }
-        cout << "[GA] Algoritmo finalizado! Melhor fitness: " << best_global.fitness << endl;
-        return best_global;
+        return decode_status::complete;
     }
 
-    
-    // --- Funções utilitárias para visualização do cronograma ---
-    int extract_num_patients_from_filename(const string &filename) {
-        // tenta encontrar um número antes da palavra 'pacientes' ou 'paciente' no nome do arquivo
-        size_t pos = filename.find("pacientes");
-        if (pos == string::npos) pos = filename.find("paciente");
-        if (pos == string::npos) return 0;
+    /// @brief Fitness devolvido por uma decodificação interrompida.
+    double stopped_fitness(decode_status status) const {
+        return status == decode_status::rejected ? rejected_fitness : (double)horizon * 2.0;
+    }
 
-        // procurar dígitos à esquerda
-        int i = (int)pos - 1;
-        while (i >= 0 && !isdigit((unsigned char)filename[i])) i--;
-        if (i < 0) return 0;
-        int j = i;
-        while (j >= 0 && isdigit((unsigned char)filename[j])) j--;
 
-        string num = filename.substr(j + 1, i - j);
-        try {
-            return stoi(num);
-        } catch (...) {
-            return 0;
+    /**
+     * @brief Move a atividade da posição i para uma posição sorteada da sua
+     * janela viável [último predecessor + 1, primeiro sucessor - 1].
+     * * Custa O(grau + distância do deslocamento); position_in_list é mantido
+     * atualizado para as próximas mutações do mesmo filho.
+     */
+    void shift_activity(int *activity_list, vector<int> &position_in_list, int i, mt19937 &generator) const {
+        int activity = activity_list[i];
+
+        int lo = 0;
+        int hi = number_of_jobs - 1;
+        for (int pred_id : nodes[activity].predecessors) lo = max(lo, position_in_list[pred_id] + 1);
+        for (int succ_id : nodes[activity].successors) hi = min(hi, position_in_list[succ_id] - 1);
+        if (lo >= hi) return;
+
+        uniform_int_distribution<int> dist(lo, hi);
+        int j = dist(generator);
+
+        for (int k = i; k > j; --k) {
+            activity_list[k] = activity_list[k - 1];
+            position_in_list[activity_list[k]] = k;
+        }
+        for (int k = i; k < j; ++k) {
+            activity_list[k] = activity_list[k + 1];
+            position_in_list[activity_list[k]] = k;
         }
+        activity_list[j] = activity;
+        position_in_list[activity] = j;
     }
 
-    void print_schedule_console(individual &ind, const string &instance_name) {
-        cout << "\n--- Cronograma para instância: " << instance_name << " ---" << endl;
+    /**
+     * @brief Gera um filho do crossover de um ou dois pontos em O(n).
+     * * Posições [0, q1) vêm de first, [q1, q2) das próximas atividades de second
+     * ainda não usadas e [q2, n) das restantes de first, na ordem de cada pai
+     * (com q2 = n o operador é o de um ponto). A pertinência ao filho é marcada
+     * com o carimbo de geração da população, sem busca linear nem alocação.
+     */
+    void crossover_child(const int *first, const int *second, int q1, int q2, int *child,
+                         population_storage &population) const {
+        unsigned int stamp = population.next_stamp();
+        vector<unsigned int> &taken = population.stamps;
+
+        int length = 0;
+        for (int i = 0; i < q1; ++i) {
+            taken[first[i]] = stamp;
+            child[length++] = first[i];
+        }
+        for (int i = 0; length < q2 && i < number_of_jobs; ++i) {
+            if (taken[second[i]] != stamp) {
+                taken[second[i]] = stamp;
+                child[length++] = second[i];
+            }
+        }
+        for (int i = q1; length < number_of_jobs; ++i) {
+            if (taken[first[i]] != stamp) {
+                taken[first[i]] = stamp;
+                child[length++] = first[i];
+            }
+        }
+    }
 
-        int num_patients = extract_num_patients_from_filename(instance_name);
-        int total_real_activities = number_of_jobs - 2; // remover source/sink
+    /**
+     * @brief Migração entre ilhas (membros ordenados pelo fitness).
+     * Os migrantes são copiados de todas as ilhas antes de qualquer substituição,
+     * então a ordem de processamento das ilhas não influencia o resultado. Cada
+     * imigrante substitui o pior membro da ilha de destino, se for melhor que ele.
+     */
+    void migrate(vector<population_storage> &islands, const island_options &options) {
+        int number_of_islands = (int)islands.size();
+        if (number_of_islands < 2 || options.migrants <= 0) return;
 
-        if (num_patients > 0 && total_real_activities % num_patients == 0) {
-            int activities_per_patient = total_real_activities / num_patients;
-            vector<vector<tuple<int,int,int,int>>> by_patient(num_patients + 1);
+        int migrants = min(options.migrants, (int)islands[0].members.size());
 
-            for (const auto &p : ind.start_times) {
-                int id = p.first; // 0-based
-                if (id == 0 || id == number_of_jobs - 1) continue; // ignorar source/sink
-                int start = p.second;
-                int finish = ind.finish_times.count(id) ? ind.finish_times.at(id) : (start + nodes[id].duration_time);
-                int printed_id = id + 1; // para compatibilidade com parser (1-based)
-                int paciente_num = ((printed_id - 2) / activities_per_patient) + 1;
-                if (paciente_num < 1 || paciente_num > num_patients) paciente_num = 0;
-                if (paciente_num == 0) continue;
-                by_patient[paciente_num].push_back(make_tuple(printed_id, start, finish, nodes[id].duration_time));
+        population_storage emigrants;
+        emigrants.allocate(number_of_islands * migrants, 0, number_of_jobs);
+        for (int i = 0; i < number_of_islands; ++i) {
+            for (int m = 0; m < migrants; ++m) {
+                emigrants.copy_slot(islands[i], islands[i].members[m], i * migrants + m);
             }
+        }
 
-            for (int p = 1; p <= num_patients; ++p) {
-                cout << "\nPaciente " << p << ":" << endl;
-                auto &list = by_patient[p];
-                sort(list.begin(), list.end(), [](const tuple<int,int,int,int> &a, const tuple<int,int,int,int> &b){
-                    return get<1>(a) < get<1>(b);
-                });
-                for (auto &t : list) {
-                    cout << "  Atividade " << get<0>(t) << " | Inicia: " << get<1>(t) << " | Termina: " << get<2>(t) << " | Dur: " << get<3>(t) << endl;
+        for (int target = 0; target < number_of_islands; ++target) {
+            population_storage &island = islands[target];
+            vector<int> &members = island.members;
+
+            for (int source = 0; source < number_of_islands; ++source) {
+                if (source == target) continue;
+                bool neighbour = options.topology == migration_topology::fully_connected ||
+                                 (source + 1) % number_of_islands == target;
+                if (!neighbour) continue;
+
+                for (int m = 0; m < migrants; ++m) {
+                    int from = source * migrants + m;
+                    if (emigrants.fitness[from] < island.fitness[island.worst()]) {
+                        island.copy_slot(emigrants, from, island.worst());
+                        // reposiciona o imigrante mantendo os membros ordenados
+                        for (size_t k = members.size() - 1;
+                             k > 0 && island.fitness[members[k]] < island.fitness[members[k - 1]]; --k) {
+                            swap(members[k], members[k - 1]);
+                        }
+                    }
                 }
             }
-        } else {
-            // fallback: imprime lista plana de tarefas com tempos
-            cout << "(Formato padrão) Jobs | Start | Finish | Dur" << endl;
-            vector<int> ids;
-            for (const auto &p : ind.start_times) ids.push_back(p.first);
-            sort(ids.begin(), ids.end());
-            for (int id : ids) {
-                int start = ind.start_times.at(id);
-                int finish = ind.finish_times.count(id) ? ind.finish_times.at(id) : (start + nodes[id].duration_time);
-                cout << "Job " << id + 1 << " | " << start << " | " << finish << " | " << nodes[id].duration_time << endl;
-            }
         }
-
-        cout << "--- Fim do cronograma ---\n" << endl;
     }
 
-    private:
-    // --- Métodos Auxiliares Internos do project ---
-
     /**
      * @brief Forward Pass: Calcula Earliest Start (ES) e Earliest Finish (EF).
      * Itera de 0 a N-1.
@@ -1054,38 +3437,734 @@ struct project {
 
         return instance_filepath;
     }
+};
 
-    /**
-     * @brief Carrega todo o conteúdo de um arquivo para a memória.
-     * * Lê o arquivo linha por linha e armazena em um vetor de strings,
-     * permitindo acesso aleatório às linhas (ex: acessar linha X diretamente).
-     * * @param full_path O caminho completo para o arquivo a ser lido.
-     * @return vector<string> Um vetor contendo as linhas do arquivo. Retorna um
-     * vetor vazio {} em caso de erro.
-     */
-    vector<string> load_file_in_memory(string full_path) {
 
-        ifstream file(full_path);
+// --- Benchmarks (./ga_rcpsp --bench <nome>) ---
 
-        if (!file.is_open()) {
-            cerr << "Erro: Não foi possível abrir o arquivo " << full_path << endl;
-            return {};
+/**
+ * @brief Gera uma ordem topológica aleatória (Kahn com escolha uniforme entre
+ * as elegíveis). Usada só para montar populações de teste rapidamente.
+ */
+void random_topological_order(const project &p, mt19937 &generator, int *activity_list) {
+    vector<int> remaining_predecessors(p.number_of_jobs);
+    vector<int> eligibles;
+    for (const node &nd : p.nodes) {
+        remaining_predecessors[nd.id] = (int)nd.predecessors.size();
+        if (nd.predecessors.empty()) eligibles.push_back(nd.id);
+    }
+
+    int length = 0;
+    while (!eligibles.empty()) {
+        uniform_int_distribution<int> dist(0, (int)eligibles.size() - 1);
+        int k = dist(generator);
+        int selected = eligibles[k];
+        eligibles[k] = eligibles.back();
+        eligibles.pop_back();
+
+        activity_list[length++] = selected;
+        for (int succ_id : p.nodes[selected].successors) {
+            if (--remaining_predecessors[succ_id] == 0) eligibles.push_back(succ_id);
+        }
+    }
+}
+
+/**
+ * @brief Vazão do crossover (filhos por segundo) para instâncias de ~400, 2000
+ * e 10000 atividades, com os operadores de um e de dois pontos.
+ */
+void bench_crossover(const project &base) {
+    const int pop_size = 100;
+
+    cout << "Jobs,Operator,Children/s" << endl;
+    for (int patients : {50, 250, 1250}) {
+        project p;
+        p.build_multi_patient_instance(base, patients);
+        p.set_seed(1);
+
+        population_storage population;
+        population.allocate(pop_size, pop_size, p.number_of_jobs);
+        for (int slot : population.members) random_topological_order(p, p.rng, population.activity_list(slot));
+
+        for (crossover_operator op : {crossover_operator::one_point, crossover_operator::two_point}) {
+            p.crossover_type = op;
+
+            long long children = 0;
+            auto start = chrono::steady_clock::now();
+            double elapsed = 0.0;
+            while (elapsed < 0.5) {
+                p.crossover(population, p.rng);
+                children += (long long)population.offspring.size();
+                elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            }
+
+            for (int slot : population.offspring) {
+                vector<int> positions;
+                if (!is_precedence_feasible(population.activity_list(slot), p.number_of_jobs, p.nodes, positions)) {
+                    cerr << "Filho inviável gerado pelo crossover!" << endl;
+                }
+            }
+
+            cout << p.number_of_jobs << "," << (op == crossover_operator::one_point ? "one_point" : "two_point")
+                 << "," << fixed << setprecision(0) << children / elapsed << endl;
+        }
+    }
+}
+
+/**
+ * @brief Latência de inicialização: tempo para amostrar populações de 40 e 1000
+ * indivíduos em instâncias de ~400, 2000 e 10000 atividades (inclui o CPM).
+ */
+void bench_initial_population(const project &base) {
+    cout << "Jobs,Population,Time(ms)" << endl;
+    for (int patients : {50, 250, 1250}) {
+        project p;
+        p.build_multi_patient_instance(base, patients);
+        p.set_seed(1);
+
+        for (int pop_size : {40, 1000}) {
+            population_storage population;
+            population.allocate(pop_size, 0, p.number_of_jobs);
+
+            auto start = chrono::steady_clock::now();
+            p.create_initial_population(population, p.rng);
+            double elapsed = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+            for (int slot : population.members) {
+                vector<int> positions;
+                if (!is_precedence_feasible(population.activity_list(slot), p.number_of_jobs, p.nodes, positions)) {
+                    cerr << "Lista inicial inviável!" << endl;
+                }
+            }
+
+            cout << p.number_of_jobs << "," << pop_size << "," << fixed << setprecision(1) << elapsed << endl;
+        }
+    }
+}
+
+/**
+ * @brief Compara os SGS atuais com as versões de referência (decodificações/s)
+ * e confere que os cronogramas são idênticos.
+ */
+void bench_sgs(const project &base) {
+    const int lists = 20;
+
+    // O serial de referência é quadrático: acima de max_reference_jobs só a
+    // versão atual é medida.
+    struct decoder_pair {
+        const char *name;
+        project::sgs_function reference;
+        project::sgs_function current;
+        int max_reference_jobs;
+    };
+    const decoder_pair decoders[] = {
+        {"parallel", &project::parallel_SGS_reference, &project::parallel_SGS, INT_MAX},
+        {"serial", &project::serial_SGS_reference, &project::serial_SGS, 2002},
+    };
+
+    cout << "Jobs,Decoder,Reference(dec/s),Current(dec/s),Speedup" << endl;
+    for (int patients : {50, 250, 1250}) {
+        project p;
+        p.build_multi_patient_instance(base, patients);
+        p.set_seed(1);
+
+        population_storage population;
+        population.allocate(lists, 0, p.number_of_jobs);
+        p.create_initial_population(population, p.rng);
+
+        auto decodes_per_second = [&](project::sgs_function sgs) {
+            evaluation_context ctx;
+            long long decodes = 0;
+            auto start = chrono::steady_clock::now();
+            double elapsed = 0.0;
+            while (elapsed < 0.5 || decodes < lists) {
+                (p.*sgs)(population.activity_list(population.members[decodes % lists]), ctx);
+                decodes++;
+                elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            }
+            return decodes / elapsed;
+        };
+
+        for (const decoder_pair &decoder : decoders) {
+            if (p.number_of_jobs > decoder.max_reference_jobs) {
+                cout << p.number_of_jobs << "," << decoder.name << ",-," << fixed << setprecision(1)
+                     << decodes_per_second(decoder.current) << ",-" << endl;
+                continue;
+            }
+
+            evaluation_context reference, current;
+            for (int slot : population.members) {
+                double a = (p.*decoder.reference)(population.activity_list(slot), reference);
+                double b = (p.*decoder.current)(population.activity_list(slot), current);
+                if (a != b || reference.start_time != current.start_time) {
+                    cerr << "Cronogramas diferentes no " << decoder.name << " SGS!" << endl;
+                }
+            }
+
+            double reference_rate = decodes_per_second(decoder.reference);
+            double current_rate = decodes_per_second(decoder.current);
+            cout << p.number_of_jobs << "," << decoder.name << "," << fixed << setprecision(1)
+                 << reference_rate << "," << current_rate << "," << current_rate / reference_rate << endl;
+        }
+    }
+}
+
+/**
+ * @brief Mede a vazão do parser (MB/s): grava instâncias sintéticas de
+ * 400 a 100 mil atividades num diretório temporário e as lê repetidamente.
+ */
+void bench_parse(const project &base) {
+    cout << "Jobs,Size(MB),Time(ms),Throughput(MB/s)" << endl;
+    for (int patients : {50, 1250, 12500}) {
+        project p;
+        p.build_multi_patient_instance(base, patients);
+
+        fs::path path = fs::temp_directory_path() / ("ga_rcpsp_bench_" + to_string(patients) + ".sm");
+        if (!p.write_project(path.string())) return;
+        double megabytes = fs::file_size(path) / 1e6;
+
+        // Repete até somar ~200 ms para diluir o ruído nas instâncias pequenas.
+        project parsed;
+        int repetitions = 0;
+        double elapsed = 0;
+        while (elapsed < 200 || repetitions < 3) {
+            auto start = chrono::steady_clock::now();
+            parsed.read_project(path.string());
+            elapsed += chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            repetitions++;
         }
+        fs::remove(path);
 
-        vector<string> file_lines;
-        string line;
-        while (getline(file, line)) {
-            file_lines.push_back(line);
+        if (parsed.number_of_jobs != p.number_of_jobs) {
+            cerr << "Instância relida difere da gravada!" << endl;
         }
-        file.close();
 
-        return file_lines;
+        double per_parse = elapsed / repetitions;
+        cout << p.number_of_jobs << "," << fixed << setprecision(2) << megabytes << ","
+             << per_parse << "," << setprecision(1) << megabytes / (per_parse / 1000) << endl;
     }
-};
+}
+
+/**
+ * @brief Compara o tempo de carregamento de uma instância pelo texto (.sm +
+ * CPM) e pelo cache binário (.smc), para 400 a 100 mil atividades. Confere
+ * também que caches com duração, demanda ou disponibilidade negativa são
+ * rejeitados com a mensagem de parse_project.
+ */
+void bench_load(const project &base) {
+    cout << "Jobs,Text+CPM(ms),Cache(ms),Speedup" << endl;
+    for (int patients : {50, 1250, 12500}) {
+        project p;
+        p.build_multi_patient_instance(base, patients);
+
+        fs::path path = fs::temp_directory_path() / ("ga_rcpsp_bench_" + to_string(patients) + ".sm");
+        string cache_path = project::cache_path_for(path.string());
+        if (!p.write_project(path.string()) || !p.write_project_cache(cache_path)) return;
+
+        auto time_ms = [](auto &&load) {
+            int repetitions = 0;
+            double elapsed = 0;
+            while (elapsed < 200 || repetitions < 3) {
+                auto start = chrono::steady_clock::now();
+                load();
+                elapsed += chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                repetitions++;
+            }
+            return elapsed / repetitions;
+        };
+
+        project loaded;
+        double text_ms = time_ms([&] {
+            loaded.read_project(path.string());
+            loaded.forward_backward_scheduling();
+        });
+        int text_lower_bound = loaded.cpm_lower_bound;
+        double cache_ms = time_ms([&] { loaded.read_project_cache(cache_path); });
+
+        // Um valor negativo em cada seção, com a leitura que load_project faria.
+        int n = p.number_of_jobs, K = p.number_of_renewable_resources;
+        size_t request_index = (size_t)n + (size_t)(n - 1) * K;
+        vector<pair<size_t, string>> corruptions = {{(size_t)(n - 2), project::negative_duration_error(n - 1)},
+                                                    {request_index, project::negative_request_error(n)},
+                                                    {(size_t)n + (size_t)n * K, project::negative_availability_error()}};
+        for (auto &[index, expected] : corruptions) {
+            string corrupt_path = cache_path + ".corrupt";
+            fs::copy_file(cache_path, corrupt_path, fs::copy_options::overwrite_existing);
+            {
+                fstream file(corrupt_path, ios::binary | ios::in | ios::out);
+                int32_t value = -1;
+                file.seekp(sizeof(instance_cache_header) + index * sizeof(int32_t));
+                file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+            }
+            project corrupt;
+            string error;
+            if (corrupt.read_project_cache(corrupt_path, &error) || error != expected) {
+                cerr << "Cache corrompido aceito ou com mensagem errada: " << (error.empty() ? "(nenhuma)" : error) << endl;
+            }
+            fs::remove(corrupt_path);
+        }
+
+        fs::remove(path);
+        fs::remove(cache_path);
+
+        if (loaded.number_of_jobs != p.number_of_jobs || loaded.cpm_lower_bound != text_lower_bound) {
+            cerr << "Cache difere da instância em texto!" << endl;
+        }
+
+        cout << p.number_of_jobs << "," << fixed << setprecision(2) << text_ms << "," << cache_ms << ","
+             << setprecision(1) << text_ms / cache_ms << endl;
+    }
+}
+
+/**
+ * @brief Núcleos do perfil de recursos (resource_kernels) para durações de 1
+ * a 50: verificações (first_violation_end) e reservas por segundo de cada
+ * núcleo suportado pela CPU, em janelas sorteadas sobre o perfil de um
+ * cronograma completo de 2002 atividades. Confere também que todos os núcleos
+ * geram os mesmos cronogramas nos dois SGS.
+ */
+void bench_profile(const project &base) {
+    project p;
+    p.build_multi_patient_instance(base, 250);
+    p.set_seed(1);
+
+    population_storage population;
+    population.allocate(4, 0, p.number_of_jobs);
+    p.create_initial_population(population, p.rng);
+
+    const vector<const resource_kernels::kernel_set *> &kernels = resource_kernels::supported_kernels();
+    for (project::sgs_function sgs : {&project::parallel_SGS, &project::serial_SGS}) {
+        for (int slot : population.members) {
+            evaluation_context reference, current;
+            reference.profile.kernels = kernels.front();
+            double a = (p.*sgs)(population.activity_list(slot), reference);
+            for (const resource_kernels::kernel_set *kernel : kernels) {
+                current.profile.kernels = kernel;
+                double b = (p.*sgs)(population.activity_list(slot), current);
+                if (a != b || reference.start_time != current.start_time) {
+                    cerr << "Cronogramas diferentes com o nucleo " << kernel->name << "!" << endl;
+                }
+            }
+        }
+    }
+
+    // perfil de um cronograma completo do serial SGS (todo instante é ponto de quebra)
+    evaluation_context ctx;
+    int makespan = (int)p.serial_SGS(population.activity_list(population.members[0]), ctx);
+
+    const int queries = 4096;
+    mt19937 generator(7);
+    uniform_int_distribution<int> pick_job(1, p.number_of_jobs - 2);
+    vector<int> starts(queries);
+    vector<const int *> requests(queries);
+    vector<vector<int>> negated(queries);
+    for (int q = 0; q < queries; ++q) {
+        starts[q] = uniform_int_distribution<int>(0, makespan)(generator);
+        requests[q] = p.nodes[pick_job(generator)].renewable_resource_requirements.data();
+        negated[q].assign(requests[q], requests[q] + p.renewable_resource_availability.size());
+        for (int &r : negated[q]) r = -r;
+    }
+
+    cout << "Duration,Kernel,Checks(M/s),Books(M/s),CheckSpeedup,BookSpeedup" << endl;
+    for (int duration : {1, 2, 5, 10, 20, 35, 50}) {
+        double scalar_checks = 0, scalar_books = 0;
+        vector<int> scalar_answers;
+        for (const resource_kernels::kernel_set *kernel : kernels) {
+            resource_profile profile = ctx.profile;
+            profile.kernels = kernel;
+
+            auto rate = [&](auto &&operation) {
+                long long operations = 0;
+                auto start = chrono::steady_clock::now();
+                double elapsed = 0;
+                while (elapsed < 0.2) {
+                    for (int q = 0; q < queries; ++q) operation(q);
+                    operations += queries;
+                    elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+                }
+                return operations / elapsed / 1e6;
+            };
+
+            vector<int> answers(queries);
+            double checks = rate([&](int q) { answers[q] = profile.first_violation_end(starts[q], duration, requests[q]); });
+            // reserva e desfaz (demanda negada): o perfil não muda entre as rodadas
+            double books = rate([&](int q) {
+                profile.book(starts[q], duration, requests[q]);
+                profile.book(starts[q], duration, negated[q].data());
+            }) * 2;
+
+            if (kernel == kernels.front()) {
+                scalar_checks = checks;
+                scalar_books = books;
+                scalar_answers = answers;
+            } else if (answers != scalar_answers) {
+                cerr << "Verificacoes diferentes com o nucleo " << kernel->name << "!" << endl;
+            }
+            cout << duration << "," << kernel->name << "," << fixed << setprecision(1) << checks << "," << books
+                 << "," << setprecision(2) << checks / scalar_checks << "," << books / scalar_books << endl;
+        }
+    }
+}
+
+/**
+ * @brief Decodificadores especializados no número de recursos
+ * (select_decoders) vs. a versão dinâmica: tempo por decodificação dos dois
+ * SGS nas instâncias de instancias_geradas e em duas multi-paciente maiores.
+ */
+void bench_resources(const project &base, const string &folder_path) {
+    const int lists = 20;
+    cout << "Instance,Jobs,Resources,Decoder,Dynamic(us),Specialized(us),Speedup" << endl;
+
+    auto measure = [&](const string &name, project &p) {
+        if (p.number_of_jobs == 0) return;
+        p.set_seed(1);
+        population_storage population;
+        population.allocate(lists, 0, p.number_of_jobs);
+        p.create_initial_population(population, p.rng);
+
+        for (auto decoder : {make_pair("parallel", &project::parallel_SGS), make_pair("serial", &project::serial_SGS)}) {
+            auto microseconds_per_decode = [&](bool specialize) {
+                p.select_decoders(specialize);
+                evaluation_context ctx;
+                long long decodes = 0;
+                auto start = chrono::steady_clock::now();
+                double elapsed = 0.0;
+                while (elapsed < 0.3 || decodes < lists) {
+                    (p.*decoder.second)(population.activity_list(population.members[decodes % lists]), ctx);
+                    decodes++;
+                    elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+                }
+                return elapsed * 1e6 / decodes;
+            };
+            double dynamic = microseconds_per_decode(false);
+            double specialized = microseconds_per_decode(true);
+            cout << name << "," << p.number_of_jobs << "," << p.number_of_renewable_resources << "," << decoder.first
+                 << "," << fixed << setprecision(1) << dynamic << "," << specialized << "," << setprecision(2)
+                 << dynamic / specialized << endl;
+        }
+    };
+
+    vector<string> files;
+    for (const auto &entry : fs::directory_iterator(folder_path)) {
+        if (entry.path().extension() == ".sm") files.push_back(entry.path().string());
+    }
+    sort(files.begin(), files.end());
+    for (const string &file : files) {
+        project p;
+        p.read_project(file);
+        measure(fs::path(file).filename().string(), p);
+    }
+    for (int patients : {250, 1250}) {
+        project p;
+        p.build_multi_patient_instance(base, patients);
+        measure(to_string(patients) + " pacientes (montada)", p);
+    }
+}
+
+/**
+ * @brief Memória da instância no layout de node (três vetores por tarefa)
+ * vs. o layout compacto (compact_instance), para 50, 1250 e 12500 pacientes
+ * (até ~100 mil atividades). Os blocos do heap são estimados como no glibc:
+ * 8 bytes de cabeçalho, múltiplos de 16 e no mínimo 32 bytes.
+ */
+void bench_memory(const project &base) {
+    auto heap_block = [](size_t bytes) -> size_t {
+        return bytes == 0 ? 0 : max<size_t>(32, (bytes + 8 + 15) / 16 * 16);
+    };
+    auto vector_bytes = [&](const auto &v) { return heap_block(v.capacity() * sizeof(v[0])); };
+
+    cout << "Patients,Jobs,Arcs,NodeLayout(B),Compact(B),Graph(B),Durations,Requests,CPM(B),RequestRows(B),"
+            "NodeB/Job,CompactB/Job,Ratio"
+         << endl;
+    for (int patients : {50, 1250, 12500}) {
+        project p;
+        p.build_multi_patient_instance(base, patients);
+        if (p.number_of_jobs == 0) continue;
+        p.forward_backward_scheduling();
+
+        size_t node_layout = vector_bytes(p.nodes);
+        for (const node &nd : p.nodes) {
+            node_layout += vector_bytes(nd.predecessors) + vector_bytes(nd.successors) +
+                           vector_bytes(nd.renewable_resource_requirements);
+        }
+        const compact_instance &c = p.compact;
+        compact_instance::memory_usage usage = c.memory();
+        size_t request_rows = p.request_rows.size() * sizeof(int);
+        double jobs = p.number_of_jobs;
+
+        cout << patients << "," << p.number_of_jobs << "," << c.successors.ids.size() << "," << node_layout << ","
+             << usage.total() << "," << usage.graph << "," << c.durations.type_name() << ":" << usage.durations << ","
+             << c.requests.type_name() << ":" << usage.requests << "," << usage.cpm << "," << request_rows << ","
+             << fixed << setprecision(1) << node_layout / jobs << "," << usage.total() / jobs << ","
+             << setprecision(2) << (double)node_layout / usage.total() << endl;
+        cout.unsetf(ios::floatfield);
+    }
+}
+
+/**
+ * @brief Tempo até o alvo (o melhor limitante inferior) com e sem o
+ * forward-backward improvement, nas instâncias de 25, 40 e 50 pacientes.
+ * Cada combinação roda com 5 sementes e até 3 s; o tempo médio é dos solves
+ * que chegaram ao alvo.
+ */
+void bench_fbi(const string &folder_path) {
+    struct mode {
+        const char *name;
+        justification_mode justification;
+    };
+    const mode modes[] = {{"off", justification_mode::off},
+                          {"each", justification_mode::offspring},
+                          {"elite", justification_mode::elites},
+                          {"p=0.2", justification_mode::probability}};
+    const pair<const char *, project::sgs_function> decoders[] = {{"parallel", &project::parallel_SGS},
+                                                                  {"serial", &project::serial_SGS}};
+    const int seeds = 5;
+
+    cout << "Instance,Decoder,FBI,Target,Reached,TimeToTarget(ms),Evaluations,MeanBest" << endl;
+    for (int patients : {25, 40, 50}) {
+        string file_name = "folfiri_" + to_string(patients) + "_pacientes.sm";
+        project p;
+        p.read_project((fs::path(folder_path) / file_name).string());
+        if (p.number_of_jobs == 0) continue;
+
+        for (const auto &decoder : decoders) {
+            for (const mode &m : modes) {
+                solve_options options;
+                options.sgs = decoder.second;
+                options.max_generations = -1;
+                options.time_limit_ms = 3000;
+                options.justification = m.justification;
+                options.log = nullptr;
+
+                int reached = 0;
+                double time_to_target = 0.0, best = 0.0;
+                long long evaluations = 0;
+                for (int seed = 1; seed <= seeds; ++seed) {
+                    p.set_seed(seed);
+                    solve_result result = p.solve(options);
+
+                    best += result.best.fitness / seeds;
+                    if (result.best.fitness <= p.bounds.best()) {
+                        reached++;
+                        time_to_target += result.statistics.best_found_ms;
+                        evaluations += result.statistics.evaluations;
+                    }
+                }
+
+                cout << file_name << "," << decoder.first << "," << m.name << "," << p.bounds.best() << "," << reached
+                     << "/" << seeds << "," << fixed << setprecision(1)
+                     << (reached ? time_to_target / reached : 0.0) << "," << (reached ? evaluations / reached : 0)
+                     << "," << best << endl;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Confere que o cache de fitness não muda o GA com --canonical, em
+ * instâncias de 5 e 12 pacientes montadas de cada base de um paciente na
+ * pasta da base, com o serial SGS:
+ * - Replay: cada lista da população inicial é avaliada duas vezes com o
+ *   cache (a segunda é um acerto) e uma vez sem; as três devem deixar a
+ *   mesma lista e o mesmo fitness no slot;
+ * - SamePopulation: população final e melhor makespan de 100 gerações com
+ *   o cache e com --fitness-cache 0, com 1 e 4 threads;
+ * - NonCanonical: membros finais (com o cache) cuja lista não é canônica.
+ * @return int 1 se alguma conferência falhou.
+ */
+int bench_canonical_cache(const string &base_instance_path) {
+    vector<string> files;
+    for (const auto &entry : fs::directory_iterator(fs::path(base_instance_path).parent_path())) {
+        if (entry.path().extension() == ".sm") files.push_back(entry.path().string());
+    }
+    sort(files.begin(), files.end());
+
+    auto list_of = [](const project &p, const population_storage &pop, int slot) {
+        return vector<int>(pop.activity_list(slot), pop.activity_list(slot) + p.number_of_jobs);
+    };
+
+    int failures = 0;
+    cout << "Base,Patients,Threads,Seed,Replay,SamePopulation,NonCanonical,CacheHits" << endl;
+    for (const string &file : files) {
+        project base;
+        base.read_project(file);
+        if (base.number_of_jobs == 0) continue;
+
+        for (int patients : {5, 12}) {
+            for (int threads : {1, 4}) {
+                for (int seed = 1; seed <= 3; ++seed) {
+                    project cached, uncached;
+                    for (project *p : {&cached, &uncached}) {
+                        p->build_multi_patient_instance(base, patients);
+                        p->set_threads(threads);
+                        p->canonicalize = true;
+                        p->set_seed(seed);
+                    }
+                    uncached.fitness_cache_size = 0;
+                    cached.cache.configure(cached.number_of_jobs, 4096, true);
+
+                    // Replay: acerto e decodificação deixam o slot igual
+                    bool replay = true;
+                    population_storage pop;
+                    pop.allocate(20, 0, cached.number_of_jobs);
+                    cached.create_initial_population(pop, cached.rng);
+                    population_storage first = pop, second = pop, plain = pop;
+                    evaluation_context ctx;
+                    for (int slot : pop.members) {
+                        cached.evaluate(first, slot, &project::serial_SGS, ctx);
+                        cached.evaluate(second, slot, &project::serial_SGS, ctx);
+                        uncached.evaluate(plain, slot, &project::serial_SGS, ctx);
+                        replay = replay && list_of(cached, first, slot) == list_of(cached, plain, slot) &&
+                                 list_of(cached, second, slot) == list_of(cached, plain, slot) &&
+                                 first.fitness[slot] == plain.fitness[slot] &&
+                                 second.fitness[slot] == plain.fitness[slot];
+                    }
+
+                    cached.set_seed(seed);
+                    solve_options options;
+                    options.sgs = &project::serial_SGS;
+                    options.max_generations = 100;
+                    options.log = nullptr;
+                    solve_result with_cache = cached.solve(options);
+                    solve_result without_cache = uncached.solve(options);
+
+                    bool same = with_cache.best.fitness == without_cache.best.fitness &&
+                                cached.population.members.size() == uncached.population.members.size();
+                    int non_canonical = 0;
+                    for (size_t i = 0; same && i < cached.population.members.size(); ++i) {
+                        int a = cached.population.members[i], b = uncached.population.members[i];
+                        same = list_of(cached, cached.population, a) == list_of(uncached, uncached.population, b) &&
+                               cached.population.fitness[a] == uncached.population.fitness[b];
+                    }
+                    for (int slot : cached.population.members) {
+                        double fitness = cached.population.fitness[slot];
+                        if (fitness == rejected_fitness || fitness == (double)cached.horizon * 2.0) continue;
+                        population_storage copy_of_member;
+                        copy_of_member.allocate(1, 0, cached.number_of_jobs);
+                        vector<int> list = list_of(cached, cached.population, slot);
+                        copy(list.begin(), list.end(), copy_of_member.activity_list(0));
+                        cached.serial_SGS(list.data(), ctx);
+                        non_canonical += cached.canonicalize_slot(copy_of_member, 0, ctx);
+                    }
+
+                    failures += !replay || !same || non_canonical > 0;
+                    cout << fs::path(file).filename().string() << "," << patients << "," << threads << "," << seed
+                         << "," << (replay ? "ok" : "FALHOU") << "," << (same ? "ok" : "FALHOU") << ","
+                         << non_canonical << "," << with_cache.statistics.cache_hits << endl;
+                }
+            }
+        }
+    }
+    return failures ? 1 : 0;
+}
+
+/**
+ * @brief Padrão cíclico (project::solve_by_pattern) vs. GA em instâncias de
+ * 50, 500 e 5000 pacientes montadas de cada instância base de um paciente na
+ * pasta da base (a multirrecurso e as variantes folfiri_RS_*). O GA usa os
+ * parâmetros padrão, com até 30 s; os dois tempos incluem só a solução (o
+ * limitante é calculado antes).
+ */
+void bench_pattern(const string &base_instance_path) {
+    vector<string> files;
+    for (const auto &entry : fs::directory_iterator(fs::path(base_instance_path).parent_path())) {
+        if (entry.path().extension() == ".sm") files.push_back(entry.path().string());
+    }
+    sort(files.begin(), files.end());
+
+    cout << "Base,Patients,Jobs,LowerBound,GA,GA(ms),GAGap(%),Pattern,Pattern(ms),PatternGap(%),PatientsPerPattern,Period"
+         << endl;
+    for (const string &file : files) {
+        project base;
+        base.read_project(file);
+        if (base.number_of_jobs == 0) continue;
+
+        for (int patients : {50, 500, 5000}) {
+            project p;
+            p.build_multi_patient_instance(base, patients);
+            p.set_seed(1);
+            p.compute_bounds(discarded_log());
+            solve_options options;
+            options.time_limit_ms = 30000;
+            options.log = nullptr;
+            solve_result ga = p.solve(options);
+            pattern_result pattern = p.solve_by_pattern(pattern_options());
+
+            double lb = p.bounds.best();
+            streamsize precision = cout.precision();
+            cout << fs::path(file).filename().string() << "," << patients << "," << p.number_of_jobs << ","
+                 << (long long)lb << "," << (long long)ga.best.fitness << "," << fixed << setprecision(1)
+                 << ga.statistics.elapsed_ms << "," << setprecision(2) << 100.0 * (ga.best.fitness - lb) / lb << ","
+                 << (long long)pattern.best.fitness << "," << setprecision(1) << pattern.elapsed_ms << ","
+                 << setprecision(2) << 100.0 * (pattern.best.fitness - lb) / lb << "," << pattern.patients_per_pattern
+                 << "," << pattern.period << endl;
+            cout.unsetf(ios::floatfield);
+            cout.precision(precision);
+        }
+    }
+}
+
+/**
+ * @brief Executa o benchmark pedido na linha de comando.
+ * @return int Código de saída do programa.
+ */
+int run_benchmark(const string &name, const string &base_instance_path, const string &folder_path) {
+    project base;
+    base.read_project(base_instance_path);
+    if (base.number_of_jobs == 0) return 1;
+
+    if (name == "crossover") {
+        bench_crossover(base);
+    } else if (name == "init") {
+        bench_initial_population(base);
+    } else if (name == "parse") {
+        bench_parse(base);
+    } else if (name == "load") {
+        bench_load(base);
+    } else if (name == "sgs") {
+        bench_sgs(base);
+    } else if (name == "profile") {
+        bench_profile(base);
+    } else if (name == "resources") {
+        bench_resources(base, folder_path);
+    } else if (name == "fbi") {
+        bench_fbi(folder_path);
+    } else if (name == "memory") {
+        bench_memory(base);
+    } else if (name == "pattern") {
+        bench_pattern(base_instance_path);
+    } else if (name == "canonical") {
+        return bench_canonical_cache(base_instance_path);
+    } else {
+        cerr << "Benchmark desconhecido: " << name << endl;
+        return 1;
+    }
+    return 0;
+}
+
 
+/**
+ * @brief Grava o cache binário (.smc) de cada instância .sm informada.
+ * @return int Código de saída (1 se alguma instância falhou).
+ */
+int compile_instances(const vector<string> &sources) {
+    int failures = 0;
+    for (const string &source : sources) {
+        project p;
+        p.read_project(source);
+        string cache_path = project::cache_path_for(source);
+        if (p.number_of_jobs == 0 || !p.write_project_cache(cache_path)) {
+            failures++;
+            continue;
+        }
+        cout << source << " -> " << cache_path << " (" << p.number_of_jobs << " atividades)" << endl;
+    }
+    return failures ? 1 : 0;
+}
 
-int main() {
+int main(int argc, char *argv[]) {
     string folder_path = "../instances/instancias_geradas";
+    string base_instance_path = "../instances/folfiri_base_multirecurso.sm";
     string output_csv = "resultado_experimento.csv";
     
     // Parâmetros do GA de acordo com o artigo
@@ -1093,6 +4172,189 @@ int main() {
     int gens = 25;
     double mut = 0.05;
 
+    // Parâmetros de execução (linha de comando)
+    int threads = 1;
+    bool fixed_seed = false;
+    unsigned int seed = 0;
+    island_options islands;
+    islands.islands = 1;
+    crossover_operator crossover_type = crossover_operator::one_point;
+    mutation_operator mutation_type = mutation_operator::adjacent_swap;
+    project::sgs_function sgs = &project::parallel_SGS;
+    int checkpoint_interval = -1;
+    string bench;
+    bool use_cache = true;
+    bool early_abort = true;
+    bool canonicalize = false;
+    bool break_symmetry = false;
+    bool use_pattern = false;
+
+    // Critérios de parada adicionais (0 = desligado)
+    double time_limit_ms = 0;
+    long long max_evaluations = 0;
+    double target_makespan = 0;
+    int stall_generations = 0;
+    int fitness_cache_size = 4096;
+    int converged_diversity = 0;
+    justification_mode justification = justification_mode::off;
+    double justification_probability = 0.2;
+
+    // ./ga_rcpsp compile [arquivos.sm...]: grava os caches binários (.smc)
+    if (argc > 1 && string(argv[1]) == "compile") {
+        vector<string> sources(argv + 2, argv + argc);
+        if (sources.empty()) {
+            for (const auto &entry : fs::directory_iterator(folder_path)) {
+                if (entry.path().extension() == ".sm") sources.push_back(entry.path().string());
+            }
+            sort(sources.begin(), sources.end());
+        }
+        return compile_instances(sources);
+    }
+
+    for (int i = 1; i < argc; ++i) {
+        string option = argv[i];
+        if (option == "--no-cache") {
+            use_cache = false;
+            continue;
+        }
+        if (option == "--no-early-abort") {
+            early_abort = false;
+            continue;
+        }
+        if (option == "--canonical") {
+            canonicalize = true;
+            continue;
+        }
+        if (option == "--symmetry") {
+            break_symmetry = true;
+            continue;
+        }
+        if (option == "--pattern") {
+            use_pattern = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            cerr << "Opção sem valor: " << option << endl;
+            return 1;
+        }
+        if (option == "--threads") {
+            threads = stoi(argv[++i]);
+        } else if (option == "--seed") {
+            seed = (unsigned int)stoul(argv[++i]);
+            fixed_seed = true;
+        } else if (option == "--islands") {
+            islands.islands = stoi(argv[++i]);
+        } else if (option == "--migration-interval") {
+            islands.migration_interval = stoi(argv[++i]);
+        } else if (option == "--migrants") {
+            islands.migrants = stoi(argv[++i]);
+        } else if (option == "--topology") {
+            string topology = argv[++i];
+            if (topology == "ring") {
+                islands.topology = migration_topology::ring;
+            } else if (topology == "full") {
+                islands.topology = migration_topology::fully_connected;
+            } else {
+                cerr << "Topologia desconhecida: " << topology << " (use ring ou full)" << endl;
+                return 1;
+            }
+        } else if (option == "--crossover") {
+            string op = argv[++i];
+            if (op == "one") {
+                crossover_type = crossover_operator::one_point;
+            } else if (op == "two") {
+                crossover_type = crossover_operator::two_point;
+            } else {
+                cerr << "Crossover desconhecido: " << op << " (use one ou two)" << endl;
+                return 1;
+            }
+        } else if (option == "--mutation") {
+            string op = argv[++i];
+            if (op == "swap") {
+                mutation_type = mutation_operator::adjacent_swap;
+            } else if (op == "shift") {
+                mutation_type = mutation_operator::shift;
+            } else {
+                cerr << "Mutação desconhecida: " << op << " (use swap ou shift)" << endl;
+                return 1;
+            }
+        } else if (option == "--sgs") {
+            string decoder = argv[++i];
+            if (decoder == "parallel") {
+                sgs = &project::parallel_SGS;
+            } else if (decoder == "serial") {
+                sgs = &project::serial_SGS;
+            } else {
+                cerr << "SGS desconhecido: " << decoder << " (use parallel ou serial)" << endl;
+                return 1;
+            }
+        } else if (option == "--checkpoint-interval") {
+            checkpoint_interval = stoi(argv[++i]);
+        } else if (option == "--generations") {
+            gens = stoi(argv[++i]);
+        } else if (option == "--time-limit") {
+            time_limit_ms = stod(argv[++i]);
+        } else if (option == "--max-evaluations") {
+            max_evaluations = stoll(argv[++i]);
+        } else if (option == "--target") {
+            target_makespan = stod(argv[++i]);
+        } else if (option == "--stall") {
+            stall_generations = stoi(argv[++i]);
+        } else if (option == "--fitness-cache") {
+            fitness_cache_size = stoi(argv[++i]);
+        } else if (option == "--converge") {
+            converged_diversity = stoi(argv[++i]);
+        } else if (option == "--fbi") {
+            string mode = argv[++i];
+            if (mode == "each") {
+                justification = justification_mode::offspring;
+            } else if (mode == "elite") {
+                justification = justification_mode::elites;
+            } else if (mode == "off") {
+                justification = justification_mode::off;
+            } else {
+                justification = justification_mode::probability;
+                justification_probability = stod(mode);
+            }
+        } else if (option == "--bench") {
+            bench = argv[++i];
+        } else {
+            cerr << "Opção desconhecida: " << option << endl;
+            return 1;
+        }
+    }
+
+    if (!bench.empty()) return run_benchmark(bench, base_instance_path, folder_path);
+
+    // a diversidade só é medida sobre listas canônicas
+    if (converged_diversity > 0) canonicalize = true;
+
+    if (gens < 0 && time_limit_ms <= 0 && max_evaluations <= 0 && target_makespan <= 0 && stall_generations <= 0 &&
+        converged_diversity <= 0) {
+        cerr << "--generations -1 exige outro critério de parada (--time-limit, --max-evaluations, --target, --stall"
+                " ou --converge)"
+             << endl;
+        return 1;
+    }
+
+    solve_options options;
+    options.pop_size = pop_size;
+    options.max_generations = gens;
+    options.mutation_probability = mut;
+    options.sgs = sgs;
+    options.islands = islands;
+    options.time_limit_ms = time_limit_ms;
+    options.max_evaluations = max_evaluations;
+    options.target_makespan = target_makespan;
+    options.stall_generations = stall_generations;
+    options.converged_diversity = converged_diversity;
+    options.justification = justification;
+    options.justification_probability = justification_probability;
+    options.on_improvement = [](const incumbent_update &update) {
+        cout << "[GA] Novo incumbente: " << update.fitness << " em " << round(update.elapsed_ms * 10.0) / 10.0
+             << " ms (geracao " << update.generation << ", " << update.evaluations << " avaliacoes)" << endl;
+    };
+
     ofstream csv(output_csv);
     if (!csv.is_open()) {
         cerr << "Erro ao criar arquivo CSV." << endl;
@@ -1100,10 +4362,19 @@ int main() {
     }
 
     // Cabeçalho do CSV
-    csv << "Instance,NumJobs,LowerBound(CPM),BestMakespan,Gap(%),Time(ms)\n";
+    csv << "Instance,NumJobs,LowerBound(CPM),LowerBound(Best),BestMakespan,Gap(%),Time(ms),InitTime(ms),"
+           "Generations,Evaluations,Stop,CacheHits(%),CacheSaved(ms)\n";
     cout << "Iniciando experimentos...\n" << endl;
 
     project p;
+    p.set_threads(threads);
+    p.crossover_type = crossover_type;
+    p.mutation_type = mutation_type;
+    p.checkpoint_interval = checkpoint_interval;
+    p.early_abort = early_abort;
+    p.canonicalize = canonicalize;
+    p.break_symmetry = break_symmetry;
+    p.fitness_cache_size = fitness_cache_size;
 
     // Iterar sobre arquivos na pasta
     try {
@@ -1114,19 +4385,45 @@ int main() {
 
                 cout << "Processando: " << file_name << "... ";
 
-                // Carregar projeto
-                p.read_project(file_path);
-                
+                // Carregar projeto (do cache .smc, se estiver atualizado)
+                if (use_cache) {
+                    p.load_project(file_path);
+                } else {
+                    p.read_project(file_path);
+                }
+
                 if (p.number_of_jobs == 0) {
                     cout << "[ERRO Lendo]" << endl;
                     continue;
                 }
 
+                // Mesma semente por instância: resultados reprodutíveis e
+                // independentes da ordem dos arquivos e do número de threads
+                if (fixed_seed) p.set_seed(seed);
+
                 // Medir tempo
                 auto start = chrono::high_resolution_clock::now();
 
-                // Rodar GA (retorna o indivíduo ótimo com cronograma preenchido)
-                individual best = p.solve_instance_via_ga(pop_size, gens, mut, &project::parallel_SGS);
+                // Rodar GA (retorna o indivíduo ótimo com cronograma preenchido),
+                // ou o padrão cíclico se pedido e houver pacientes idênticos
+                solve_result solved;
+                pattern_result pattern;
+                if (use_pattern) pattern = p.solve_by_pattern(pattern_options());
+                if (pattern.patients_per_pattern > 0) {
+                    p.forward_backward_scheduling();
+                    p.compute_bounds();
+                    solved.best = pattern.best;
+                    solved.statistics.reason = stop_reason::pattern;
+                    solved.statistics.generations = 0;
+                    solved.statistics.evaluations = pattern.evaluations;
+                    cout << "[Padrao] " << pattern.tiled_patients << " pacientes em blocos de "
+                         << pattern.patients_per_pattern << " | periodo " << pattern.period << " | bloco "
+                         << pattern.pattern_makespan << " | busca " << round(pattern.search_ms * 10.0) / 10.0
+                         << " ms | makespan " << pattern.best.fitness << endl;
+                } else {
+                    solved = p.solve(options);
+                }
+                individual &best = solved.best;
 
                 auto end = chrono::high_resolution_clock::now();
                 auto duration = chrono::duration_cast<chrono::milliseconds>(end - start).count();
@@ -1134,17 +4431,26 @@ int main() {
                 double result = best.fitness;
 
                 // Calcular Métricas
-                double lb = (double)p.cpm_lower_bound;
+                // Gap em relação ao melhor limitante (o do CPM fica na sua coluna)
+                double lb = (double)p.bounds.best();
                 double gap = 0.0;
                 if (lb > 0) gap = ((result - lb) / lb) * 100.0;
 
                 // Escrever no CSV
                 csv << file_name << ","
                     << p.number_of_jobs << ","
+                    << (double)p.cpm_lower_bound << ","
                     << lb << ","
                     << result << ","
                     << fixed << setprecision(2) << gap << ","
-                    << duration << "\n";
+                    << duration << ","
+                    << p.initialization_time_ms << ","
+                    << solved.statistics.generations << ","
+                    << solved.statistics.evaluations << ","
+                    << stop_reason_name(solved.statistics.reason) << ","
+                    << (solved.statistics.cache_lookups > 0
+                            ? 100.0 * solved.statistics.cache_hits / solved.statistics.cache_lookups : 0.0) << ","
+                    << solved.statistics.cache_saved_ms << "\n";
 
                 cout << "Makespan: " << result << " | Gap: " << gap << "% | Tempo: " << duration << "ms" << endl;
                 // Imprimir cronograma no console (agrupado por paciente quando o nome do arquivo indicar)
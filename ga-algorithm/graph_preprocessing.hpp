@@ -0,0 +1,246 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "compact_instance.hpp"
+
+/**
+ * @brief Pré-processamento do grafo de precedências feito uma vez por
+ * instância: redução transitiva dos arcos, pares de atividades que não podem
+ * se sobrepor (disjuntivas) e aperto das janelas [ES, LF] com esses pares.
+ * * A entrada é o layout compacto (compact_instance) e vetores planos, como em
+ * lower_bounds.hpp, sem depender do project.
+ */
+namespace graph_preprocessing {
+
+/// @brief O que o pré-processamento encontrou e quanto tempo levou.
+struct report
+{
+    /// Arcos lidos (incluindo laços) e os removidos pela redução transitiva.
+    std::size_t arcs = 0;
+    std::size_t redundant_arcs = 0;
+    /// Pares de classes disjuntivas (0 com a matriz desligada).
+    std::size_t disjunctive_pairs = 0;
+    /// Redução e matriz de pares, feitas na leitura.
+    double graph_ms = 0.0;
+    /// Busca do limitante pelas janelas apertadas (em compute_bounds).
+    double windows_ms = 0.0;
+};
+
+/**
+ * @brief Marca os arcos transitivamente redundantes de successors: u -> v é
+ * redundante se v também é alcançável de u por outro caminho (ou se o arco
+ * aparece repetido). Com durações não negativas esses arcos nunca determinam
+ * um início, então os decodificadores podem ignorá-los.
+ * * Para cada u, os sucessores são visitados em ordem topológica (rank) e uma
+ * busca em profundidade marca os descendentes de cada um, podada no maior rank
+ * entre os sucessores; um sucessor já marcado quando chega a sua vez é
+ * redundante. Laços de um nó sobre si mesmo são mantidos. Com ciclos (rank >=
+ * n) nada é removido; se a busca passar de work_budget arcos percorridos, os
+ * nós restantes ficam com todos os arcos (manter um arco é sempre válido).
+ * @return Um byte por arco de successors.ids (1 = redundante).
+ */
+inline std::vector<char> redundant_arcs(const csr_adjacency &successors, const std::vector<int> &rank,
+                                        std::int64_t work_budget = 50000000) {
+    int n = (int)rank.size();
+    std::vector<char> redundant(successors.ids.size(), 0);
+    for (int r : rank) {
+        if (r >= n) return redundant;
+    }
+
+    std::vector<int> stamp(n, -1);
+    std::vector<int> order, stack;
+    std::int64_t work = 0;
+    for (int u = 0; u < n && work < work_budget; ++u) {
+        order.clear();
+        for (int k = successors.offsets[u]; k < successors.offsets[u + 1]; ++k) {
+            if (successors.ids[k] != u) order.push_back(k);
+        }
+        if (order.size() < 2) continue;
+        std::sort(order.begin(), order.end(),
+                  [&](int a, int b) { return rank[successors.ids[a]] < rank[successors.ids[b]]; });
+        int limit = rank[successors.ids[order.back()]];
+
+        for (int k : order) {
+            int v = successors.ids[k];
+            if (stamp[v] == u) {
+                redundant[k] = 1;
+                continue;
+            }
+            stamp[v] = u;
+            stack.push_back(v);
+            while (!stack.empty()) {
+                int x = stack.back();
+                stack.pop_back();
+                for (int y : successors[x]) {
+                    ++work;
+                    if (rank[y] > limit || stamp[y] == u) continue;
+                    stamp[y] = u;
+                    stack.push_back(y);
+                }
+            }
+        }
+    }
+    return redundant;
+}
+
+/**
+ * @brief Remove de successors os arcos marcados e remonta predecessors como
+ * a transposta (predecessores de cada nó em ordem crescente de id).
+ */
+inline void remove_arcs(csr_adjacency &successors, csr_adjacency &predecessors, const std::vector<char> &removed) {
+    int n = (int)successors.offsets.size() - 1;
+    std::vector<std::vector<std::int32_t>> kept_successors(n), kept_predecessors(n);
+    for (int u = 0; u < n; ++u) {
+        for (int k = successors.offsets[u]; k < successors.offsets[u + 1]; ++k) {
+            if (removed[k]) continue;
+            kept_successors[u].push_back(successors.ids[k]);
+            kept_predecessors[successors.ids[k]].push_back(u);
+        }
+    }
+    successors.assign(n, [&](int j) -> const std::vector<std::int32_t> & { return kept_successors[j]; });
+    predecessors.assign(n, [&](int j) -> const std::vector<std::int32_t> & { return kept_predecessors[j]; });
+}
+
+/**
+ * @brief Matriz de bits classe x classe: (a, b) marcado se uma atividade da
+ * classe a e uma da classe b não cabem juntas em algum recurso (soma das
+ * demandas acima da capacidade), ou seja, nunca podem estar em execução ao
+ * mesmo tempo. Classes de duração zero não entram em nenhum par.
+ * * É indexada pelas classes (job_class) e não pelas atividades, para caber na
+ * memória em instâncias grandes; acima de max_classes fica desligada.
+ */
+struct disjunctive_pairs
+{
+    int number_of_classes = 0;
+    std::size_t words_per_row = 0;
+    std::vector<std::uint64_t> bits;
+
+    bool enabled() const { return !bits.empty(); }
+
+    bool test(int a, int b) const { return bits[(std::size_t)a * words_per_row + (b >> 6)] >> (b & 63) & 1; }
+
+    /// @brief Soma delta ao contador de cada classe disjuntiva com a.
+    void add_to_partners(int a, std::vector<int> &counters, int delta) const {
+        const std::uint64_t *row = bits.data() + (std::size_t)a * words_per_row;
+        for (std::size_t w = 0; w < words_per_row; ++w) {
+            for (std::uint64_t word = row[w]; word; word &= word - 1) {
+                counters[w * 64 + __builtin_ctzll(word)] += delta;
+            }
+        }
+    }
+
+    /**
+     * @param duration duração de cada classe
+     * @param request demanda do recurso k da classe c em request[c * K + k]
+     */
+    void build(int classes, int K, const std::vector<int> &duration, const std::vector<int> &request,
+               const std::vector<int> &capacity, int max_classes = 4096) {
+        number_of_classes = classes;
+        words_per_row = ((std::size_t)classes + 63) / 64;
+        bits.clear();
+        if (classes > max_classes) return;
+
+        bits.assign((std::size_t)classes * words_per_row, 0);
+        for (int a = 0; a < classes; ++a) {
+            if (duration[a] <= 0) continue;
+            for (int b = a; b < classes; ++b) {
+                if (duration[b] <= 0) continue;
+                bool disjoint = false;
+                for (int k = 0; k < K && !disjoint; ++k) {
+                    disjoint = request[(std::size_t)a * K + k] + request[(std::size_t)b * K + k] > capacity[k];
+                }
+                if (!disjoint) continue;
+                bits[(std::size_t)a * words_per_row + (b >> 6)] |= std::uint64_t(1) << (b & 63);
+                bits[(std::size_t)b * words_per_row + (a >> 6)] |= std::uint64_t(1) << (a & 63);
+            }
+        }
+    }
+
+    /// @brief Pares não ordenados de classes marcados (incluindo (a, a)).
+    std::size_t count() const {
+        std::size_t total = 0;
+        for (int a = 0; a < number_of_classes && enabled(); ++a) {
+            for (int b = a; b < number_of_classes; ++b) total += test(a, b);
+        }
+        return total;
+    }
+};
+
+/**
+ * @brief Teste de um makespan T pelas janelas de tempo: ES = head e
+ * LF = T - tail de cada atividade, apertadas até um ponto fixo por
+ * - pares disjuntivos (i, j): se i não consegue terminar antes do último
+ *   início de j (ES_i + p_i > LF_j - p_j), j precede i, então
+ *   ES_i >= ES_j + p_j e LF_j <= LF_i - p_i; se nenhuma ordem é possível, T é
+ *   curto demais;
+ * - precedências: ES propagado pelos sucessores e LF pelos predecessores, na
+ *   ordem topológica.
+ * * Toda dedução vale para qualquer cronograma de makespan <= T, então uma
+ * janela vazia (ES + p > LF) prova que T é inviável. Os pares custam
+ * O(atividades^2) por rodada; se work_budget acabar o teste para e não prova
+ * nada (devolve verdadeiro), o que continua válido.
+ * @param topological_order ids em ordem topológica (sem ciclos)
+ * @return bool Falso se as janelas provam que T é curto demais.
+ */
+inline bool windows_feasible(int T, const compact_instance &instance, const std::vector<int> &job_class,
+                             const disjunctive_pairs &pairs, const std::vector<int> &topological_order,
+                             const std::vector<int> &head, const std::vector<int> &tail,
+                             std::int64_t work_budget = 20000000) {
+    int n = instance.number_of_jobs;
+    std::vector<int> es(n), lf(n), jobs;
+    for (int j = 0; j < n; ++j) {
+        es[j] = head[j];
+        lf[j] = T - tail[j];
+        if (es[j] + instance.duration(j) > lf[j]) return false;
+        if (instance.duration(j) > 0 && pairs.enabled()) jobs.push_back(j);
+    }
+
+    std::int64_t work = 0;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (std::size_t a = 0; a < jobs.size(); ++a) {
+            int i = jobs[a], pi = instance.duration(i);
+            work += (std::int64_t)(jobs.size() - a);
+            if (work > work_budget) return true;
+            for (std::size_t b = a + 1; b < jobs.size(); ++b) {
+                int j = jobs[b], pj = instance.duration(j);
+                if (!pairs.test(job_class[i], job_class[j])) continue;
+
+                bool i_first = es[i] + pi <= lf[j] - pj;
+                bool j_first = es[j] + pj <= lf[i] - pi;
+                if (!i_first && !j_first) return false;
+                if (!i_first) {
+                    if (es[i] < es[j] + pj) es[i] = es[j] + pj, changed = true;
+                    if (lf[j] > lf[i] - pi) lf[j] = lf[i] - pi, changed = true;
+                } else if (!j_first) {
+                    if (es[j] < es[i] + pi) es[j] = es[i] + pi, changed = true;
+                    if (lf[i] > lf[j] - pj) lf[i] = lf[j] - pj, changed = true;
+                }
+            }
+        }
+        if (!changed) break;
+
+        for (int u : topological_order) {
+            for (int s : instance.successors[u]) {
+                if (s != u) es[s] = std::max(es[s], es[u] + instance.duration(u));
+            }
+        }
+        for (auto it = topological_order.rbegin(); it != topological_order.rend(); ++it) {
+            int u = *it;
+            for (int s : instance.successors[u]) {
+                if (s != u) lf[u] = std::min(lf[u], lf[s] - instance.duration(s));
+            }
+        }
+        for (int j = 0; j < n; ++j) {
+            if (es[j] + instance.duration(j) > lf[j]) return false;
+        }
+    }
+    return true;
+}
+
+} // namespace graph_preprocessing
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @brief Formato binário do cache de instâncias (.smc).
+ * * O arquivo é o cabeçalho abaixo seguido de vetores int32 contíguos, nesta
+ * ordem:
+ *   durações[n], demandas[n * K] (por atividade), disponibilidades[K],
+ *   offsets de sucessores[n + 1], sucessores[arcos],
+ *   offsets de predecessores[n + 1], predecessores[arcos],
+ *   ES[n], EF[n], LS[n], LF[n].
+ * * É gravado na ordem de bytes da máquina; o campo byte_order recusa caches
+ * vindos de outra arquitetura. Mudanças no layout devem incrementar
+ * instance_cache_version.
+ */
+constexpr char instance_cache_magic[8] = {'R', 'C', 'P', 'S', 'P', 'S', 'M', 'C'};
+constexpr std::uint32_t instance_cache_version = 1;
+constexpr std::uint32_t instance_cache_byte_order = 0x01020304;
+
+struct instance_cache_header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::int32_t number_of_jobs;
+    std::int32_t number_of_resources;
+    std::int32_t horizon;
+    std::int32_t cpm_lower_bound;
+    std::uint64_t number_of_arcs;
+
+    /// @brief Número de int32 que seguem o cabeçalho.
+    std::uint64_t payload_ints() const {
+        std::uint64_t n = (std::uint64_t)number_of_jobs;
+        std::uint64_t k = (std::uint64_t)number_of_resources;
+        return n + n * k + k + 2 * (n + 1 + number_of_arcs) + 4 * n;
+    }
+
+    /// @brief Verifica assinatura, versão, ordem de bytes e o tamanho do arquivo.
+    bool is_valid(std::uint64_t file_size) const {
+        return std::memcmp(magic, instance_cache_magic, sizeof(magic)) == 0 &&
+               version == instance_cache_version &&
+               byte_order == instance_cache_byte_order &&
+               number_of_jobs >= 2 && number_of_resources >= 0 &&
+               file_size == sizeof(instance_cache_header) + payload_ints() * sizeof(std::int32_t);
+    }
+};
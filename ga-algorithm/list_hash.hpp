@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Hash de 64 bits de uma activity_list: polinomial sobre os ids com
+ * mistura final (splitmix64). Nunca devolve 0, que fica livre para marcar
+ * posições vazias em tabelas.
+ */
+inline std::uint64_t hash_activity_list(const int *list, int number_of_jobs) {
+    std::uint64_t h = 0x9e3779b97f4a7c15ULL;
+    for (int i = 0; i < number_of_jobs; ++i) h = h * 0x100000001b3ULL + (std::uint32_t)list[i];
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h ? h : 1;
+}
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Limitantes inferiores do makespan calculados só com os dados da
+ * instância (durações, demandas, capacidades e os caminhos críticos).
+ * * A entrada é plana para não depender do project: cada atividade j tem
+ * duração duration[j], demanda request[j * K + k] do recurso k, cabeça head[j]
+ * (maior caminho da origem até o início de j) e cauda tail[j] (maior caminho do
+ * término de j até o fim). Todos os limitantes valem para qualquer cronograma
+ * viável, então o maior deles também vale.
+ */
+struct lower_bounds
+{
+    /// Maior caminho do grafo de precedências (head + duração + tail).
+    int critical_path = 0;
+    /// LB2: para cada recurso, trabalho total / capacidade, arredondado para cima.
+    int resource_work = 0;
+    /// Soma das durações de um conjunto de atividades que duas a duas não
+    /// cabem juntas em algum recurso (não podem se sobrepor no tempo).
+    int disjunctive = 0;
+    /// Bin packing (L2 de Martello e Toth) por recurso: cada unidade de tempo
+    /// de uma atividade é um item do tamanho da demanda, cada instante é um bin.
+    int bin_packing = 0;
+    /// Raciocínio energético sobre janelas [head, makespan - tail].
+    int energetic = 0;
+    /// Janelas [ES, LF] apertadas por pares disjuntivos e precedências
+    /// (graph_preprocessing::windows_feasible); calculado pelo project.
+    int windows = 0;
+
+    int best() const {
+        return std::max({critical_path, resource_work, disjunctive, bin_packing, energetic, windows});
+    }
+};
+
+namespace lower_bound_detail {
+
+/// @brief Um tipo de item do bin packing: demanda (size) e quantas unidades de tempo.
+struct item
+{
+    int size;
+    std::int64_t count;
+};
+
+/**
+ * @brief L2 de Martello e Toth para itens ordenados por size decrescente.
+ * * Para cada alpha <= C/2: itens maiores que C - alpha ficam sozinhos (J1),
+ * os maiores que C/2 não dividem bin entre si (J2) e os de tamanho em
+ * [alpha, C/2] (J3) só cabem no espaço livre dos bins de J2 ou em bins novos.
+ */
+inline std::int64_t martello_toth_l2(const std::vector<item> &items, int capacity) {
+    std::int64_t best = 0;
+    std::int64_t total = 0;
+    for (const item &it : items) total += it.count * it.size;
+    best = (total + capacity - 1) / capacity;
+
+    std::vector<int> alphas = {0};
+    for (const item &it : items) {
+        if (2 * it.size <= capacity) alphas.push_back(it.size);
+    }
+
+    for (int alpha : alphas) {
+        std::int64_t n1 = 0, n2 = 0, size2 = 0, size3 = 0;
+        for (const item &it : items) {
+            if (it.size > capacity - alpha) {
+                n1 += it.count;
+            } else if (2 * it.size > capacity) {
+                n2 += it.count;
+                size2 += it.count * it.size;
+            } else if (it.size >= alpha) {
+                size3 += it.count * it.size;
+            }
+        }
+        std::int64_t overflow = size3 - (n2 * capacity - size2);
+        std::int64_t bins = n1 + n2 + (overflow > 0 ? (overflow + capacity - 1) / capacity : 0);
+        best = std::max(best, bins);
+    }
+    return best;
+}
+
+/**
+ * @brief Teste energético de um makespan T: em toda janela [t1, t2) a energia
+ * mínima que as atividades são obrigadas a gastar dentro dela (deslocadas ao
+ * máximo para a esquerda ou para a direita) cabe na capacidade.
+ * * As janelas usam os pontos notáveis das atividades (inícios e términos mais
+ * cedo e mais tarde); em instâncias grandes só parte deles, espaçados
+ * uniformemente, para limitar o custo a work_budget operações. Qualquer
+ * subconjunto de janelas continua dando um teste válido, só mais fraco.
+ * @return bool Falso se alguma janela prova que T é curto demais.
+ */
+inline bool energetic_feasible(int T, int number_of_resources, const std::vector<int> &jobs,
+                               const std::vector<int> &duration, const std::vector<int> &request,
+                               const std::vector<int> &capacity, const std::vector<int> &head,
+                               const std::vector<int> &tail, std::int64_t work_budget) {
+    std::vector<int> lefts, rights;
+    for (int j : jobs) {
+        int deadline = T - tail[j];
+        lefts.push_back(head[j]);
+        lefts.push_back(deadline - duration[j]);
+        rights.push_back(head[j] + duration[j]);
+        rights.push_back(deadline);
+    }
+    for (std::vector<int> *points : {&lefts, &rights}) {
+        std::sort(points->begin(), points->end());
+        points->erase(std::unique(points->begin(), points->end()), points->end());
+    }
+
+    std::int64_t per_window = (std::int64_t)jobs.size() * number_of_resources + 1;
+    std::int64_t max_points = 2;
+    while ((max_points + 1) * (max_points + 1) * per_window <= work_budget) max_points++;
+    for (std::vector<int> *points : {&lefts, &rights}) {
+        if ((std::int64_t)points->size() <= max_points) continue;
+        std::vector<int> sampled;
+        for (std::int64_t i = 0; i < max_points; ++i) {
+            sampled.push_back((*points)[(size_t)(i * (points->size() - 1) / (max_points - 1))]);
+        }
+        sampled.erase(std::unique(sampled.begin(), sampled.end()), sampled.end());
+        points->swap(sampled);
+    }
+
+    std::vector<std::int64_t> energy(number_of_resources);
+    for (int t1 : lefts) {
+        for (int t2 : rights) {
+            if (t2 <= t1) continue;
+            std::fill(energy.begin(), energy.end(), 0);
+
+            for (int j : jobs) {
+                int p = duration[j];
+                int deadline = T - tail[j];
+                int left_shift = std::min(head[j] + p, t2) - std::max(head[j], t1);
+                int right_shift = std::min(deadline, t2) - std::max(deadline - p, t1);
+                int work = std::min(left_shift, right_shift);
+                if (work <= 0) continue;
+                for (int k = 0; k < number_of_resources; ++k) {
+                    energy[k] += (std::int64_t)work * request[(size_t)j * number_of_resources + k];
+                }
+            }
+            for (int k = 0; k < number_of_resources; ++k) {
+                if (energy[k] > (std::int64_t)capacity[k] * (t2 - t1)) return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace lower_bound_detail
+
+/**
+ * @brief Calcula todos os limitantes. O energético é buscado por bisseção a
+ * partir do melhor dos outros (o teste é monótono em T: prazos maiores só
+ * diminuem a energia obrigatória), com upper_limit como teto.
+ * * Atividades com demanda maior que a capacidade tornam a instância inviável;
+ * nesse caso os limitantes de recurso ignoram o recurso em questão.
+ */
+inline lower_bounds compute_lower_bounds(int number_of_jobs, int number_of_resources,
+                                         const std::vector<int> &duration, const std::vector<int> &request,
+                                         const std::vector<int> &capacity, const std::vector<int> &head,
+                                         const std::vector<int> &tail, int upper_limit,
+                                         std::int64_t work_budget = 20000000) {
+    using namespace lower_bound_detail;
+    lower_bounds bounds;
+
+    for (int j = 0; j < number_of_jobs; ++j) {
+        bounds.critical_path = std::max(bounds.critical_path, head[j] + duration[j] + tail[j]);
+    }
+
+    // Atividades que consomem algum recurso; as outras não entram nos limitantes de recurso
+    std::vector<int> jobs;
+    for (int j = 0; j < number_of_jobs; ++j) {
+        if (duration[j] <= 0) continue;
+        for (int k = 0; k < number_of_resources; ++k) {
+            if (request[(size_t)j * number_of_resources + k] > 0) {
+                jobs.push_back(j);
+                break;
+            }
+        }
+    }
+
+    for (int k = 0; k < number_of_resources; ++k) {
+        int C = capacity[k];
+        if (C <= 0) continue;
+
+        bool oversized = false;
+        std::int64_t work = 0;
+        std::vector<item> items;
+        for (int j : jobs) {
+            int r = request[(size_t)j * number_of_resources + k];
+            if (r > C) oversized = true;
+            if (r <= 0) continue;
+            work += (std::int64_t)r * duration[j];
+            items.push_back({r, duration[j]});
+        }
+        if (oversized) continue;
+
+        bounds.resource_work = std::max(bounds.resource_work, (int)((work + C - 1) / C));
+
+        // Demanda acima de C/2: duas a duas disjuntas; de exatamente C/2, cabe no
+        // máximo uma junto (com qualquer outra de C/2 ela cabe)
+        std::int64_t clique = 0;
+        int longest_half = 0;
+        for (int j : jobs) {
+            int r = request[(size_t)j * number_of_resources + k];
+            if (2 * r > C) clique += duration[j];
+            else if (2 * r == C) longest_half = std::max(longest_half, duration[j]);
+        }
+        bounds.disjunctive = std::max(bounds.disjunctive, (int)(clique + longest_half));
+
+        // Agrupa itens de mesmo tamanho
+        std::sort(items.begin(), items.end(), [](const item &a, const item &b) { return a.size > b.size; });
+        std::vector<item> grouped;
+        for (const item &it : items) {
+            if (!grouped.empty() && grouped.back().size == it.size) grouped.back().count += it.count;
+            else grouped.push_back(it);
+        }
+        bounds.bin_packing = std::max(bounds.bin_packing, (int)martello_toth_l2(grouped, C));
+    }
+
+    int low = bounds.best();
+    int high = std::max(low, upper_limit);
+    if (jobs.empty() ||
+        energetic_feasible(low, number_of_resources, jobs, duration, request, capacity, head, tail, work_budget)) {
+        bounds.energetic = low;
+        return bounds;
+    }
+    // invariante: low inviável, high viável (ou o teto)
+    while (high - low > 1) {
+        int middle = low + (high - low) / 2;
+        if (energetic_feasible(middle, number_of_resources, jobs, duration, request, capacity, head, tail,
+                               work_budget)) {
+            high = middle;
+        } else {
+            low = middle;
+        }
+    }
+    bounds.energetic = high;
+    return bounds;
+}
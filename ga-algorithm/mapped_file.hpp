@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Arquivo mapeado em memória (somente leitura, POSIX).
+ * * O conteúdo é lido direto das páginas do arquivo, sem cópia para buffers
+ * intermediários. O mapeamento é desfeito no destrutor.
+ */
+struct mapped_file
+{
+    explicit mapped_file(const std::string &path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+
+        struct stat info;
+        if (::fstat(fd, &info) == 0) {
+            opened = true;
+            length = (std::size_t)info.st_size;
+            if (length > 0) {
+                void *address = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (address == MAP_FAILED) {
+                    opened = false;
+                    length = 0;
+                } else {
+                    bytes = static_cast<const char *>(address);
+                }
+            }
+        }
+        ::close(fd);
+    }
+
+    ~mapped_file() {
+        if (bytes) ::munmap(const_cast<char *>(bytes), length);
+    }
+
+    mapped_file(const mapped_file &) = delete;
+    mapped_file &operator=(const mapped_file &) = delete;
+
+    bool is_open() const { return opened; }
+    const char *data() const { return bytes; }
+    std::size_t size() const { return length; }
+
+    private:
+    const char *bytes = nullptr;
+    std::size_t length = 0;
+    bool opened = false;
+};
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <numeric>
+#include <vector>
+
+#include "compact_instance.hpp"
+
+/**
+ * @brief Grupos de pacientes intercambiáveis de uma instância multi-paciente.
+ * * Um paciente é uma componente conexa do grafo sem a fonte (0) e o sumidouro
+ * (n - 1). Dois pacientes são idênticos quando, numerando as atividades de
+ * cada um pela ordem dos ids, têm as mesmas durações, demandas, arcos internos
+ * e ligações com a fonte e o sumidouro: trocar um pelo outro (a atividade
+ * local l de um pela atividade local l do outro) leva cronogramas viáveis em
+ * cronogramas viáveis de mesmo makespan. Com N pacientes idênticos, cada
+ * cronograma aparece em até N! listas que só diferem pela troca de pacientes.
+ * * A quebra de simetria escolhe uma delas: relabel renumera os pacientes de
+ * cada grupo pela ordem em que a primeira atividade de cada um aparece na
+ * lista (o primeiro a aparecer vira o paciente de menor id). A lista continua
+ * viável e decodifica no mesmo makespan, com o cronograma renumerado.
+ */
+struct patient_symmetry
+{
+    /// Membros do grupo g: group_first[g] .. group_first[g + 1] - 1, em ordem de id.
+    std::vector<int> group_first;
+    /// Atividades do membro m, na ordem local: member_nodes[member_offset[m] .. member_offset[m + 1]).
+    std::vector<int> member_offset;
+    std::vector<int> member_nodes;
+    std::vector<int> member_group;
+    /// Membro e índice local de cada atividade (-1 fora dos grupos).
+    std::vector<int> member_of_node;
+    std::vector<int> local_of_node;
+
+    int groups() const { return (int)group_first.size() - 1; }
+    int members() const { return (int)member_group.size(); }
+    bool empty() const { return member_group.empty(); }
+
+    /**
+     * @brief Encontra os grupos de pacientes idênticos (com pelo menos dois
+     * membros) usando o grafo e os dados de instance.
+     */
+    void detect(const compact_instance &instance) {
+        int n = instance.number_of_jobs;
+        int K = instance.number_of_resources;
+        group_first.assign(1, 0);
+        member_offset.assign(1, 0);
+        member_nodes.clear();
+        member_group.clear();
+        member_of_node.assign(n, -1);
+        local_of_node.assign(n, -1);
+        if (n < 4) return;
+
+        int source = 0, sink = n - 1;
+
+        // componentes pelos arcos entre atividades reais (union-find)
+        std::vector<int> parent(n);
+        std::iota(parent.begin(), parent.end(), 0);
+        auto find = [&](int x) {
+            while (parent[x] != x) x = parent[x] = parent[parent[x]];
+            return x;
+        };
+        for (int u = 1; u < sink; ++u) {
+            for (int v : instance.successors[u]) {
+                if (v != sink && v != u) parent[find(u)] = find(v);
+            }
+        }
+        std::map<int, std::vector<int>> components; // raiz -> atividades em ordem de id
+        for (int j = 1; j < sink; ++j) components[find(j)].push_back(j);
+
+        // assinatura de cada componente na numeração local
+        std::map<std::vector<int>, std::vector<const std::vector<int> *>> by_signature;
+        std::vector<int> local(n, -1);
+        for (const auto &entry : components) {
+            const std::vector<int> &ids = entry.second;
+            for (std::size_t l = 0; l < ids.size(); ++l) local[ids[l]] = (int)l;
+
+            std::vector<int> signature = {(int)ids.size()};
+            std::vector<int> targets;
+            for (int j : ids) {
+                signature.push_back(instance.duration(j));
+                for (int k = 0; k < K; ++k) signature.push_back(instance.request(j, k));
+                targets.clear();
+                for (int p : instance.predecessors[j]) {
+                    if (p == source) targets.push_back(-1);
+                }
+                for (int s : instance.successors[j]) targets.push_back(s == sink ? -2 : local[s]);
+                std::sort(targets.begin(), targets.end());
+                signature.push_back((int)targets.size());
+                signature.insert(signature.end(), targets.begin(), targets.end());
+            }
+            by_signature[signature].push_back(&ids);
+        }
+
+        for (const auto &entry : by_signature) {
+            if (entry.second.size() < 2) continue;
+            std::vector<const std::vector<int> *> group = entry.second;
+            std::sort(group.begin(), group.end(),
+                      [](const std::vector<int> *a, const std::vector<int> *b) { return a->front() < b->front(); });
+            for (const std::vector<int> *ids : group) {
+                int m = members();
+                for (std::size_t l = 0; l < ids->size(); ++l) {
+                    member_of_node[(*ids)[l]] = m;
+                    local_of_node[(*ids)[l]] = (int)l;
+                }
+                member_nodes.insert(member_nodes.end(), ids->begin(), ids->end());
+                member_offset.push_back((int)member_nodes.size());
+                member_group.push_back(groups());
+            }
+            group_first.push_back(members());
+        }
+    }
+
+    /**
+     * @brief Renumera os pacientes de cada grupo pela ordem de aparição na
+     * lista e reescreve a lista.
+     * @param target Buffer da thread: ao final, target[m] é o membro que o
+     * membro m virou (seguido do próximo membro livre de cada grupo).
+     * @return bool Falso se a lista já estava na ordem (nada mudou).
+     */
+    bool relabel(int *list, int length, std::vector<int> &target) const {
+        if (empty()) return false;
+        int number_of_members = members();
+        target.assign(number_of_members, -1);
+        target.insert(target.end(), group_first.begin(), group_first.end() - 1);
+
+        bool identity = true;
+        for (int i = 0; i < length; ++i) {
+            int m = member_of_node[list[i]];
+            if (m < 0 || target[m] >= 0) continue;
+            target[m] = target[number_of_members + member_group[m]]++;
+            identity = identity && target[m] == m;
+        }
+        if (identity) return false;
+
+        for (int i = 0; i < length; ++i) {
+            int j = list[i];
+            int m = member_of_node[j];
+            if (m >= 0) list[i] = member_nodes[member_offset[target[m]] + local_of_node[j]];
+        }
+        return true;
+    }
+
+    /// @brief Atividade que j vira com a renumeração target (de relabel).
+    int image(int j, const std::vector<int> &target) const {
+        int m = member_of_node[j];
+        return m < 0 ? j : member_nodes[member_offset[target[m]] + local_of_node[j]];
+    }
+};
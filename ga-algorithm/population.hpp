@@ -0,0 +1,201 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "list_hash.hpp"
+#include "schedule_checkpoints.hpp"
+
+/**
+ * @brief População do GA em layout structure-of-arrays.
+ * * Todas as listas de atividades e cronogramas (inícios e términos) ficam numa
+ * única arena contígua, um bloco de number_of_jobs inteiros por slot. Um
+ * indivíduo é apenas um índice de slot: a seleção permuta índices e os
+ * operadores escrevem os filhos direto nos slots livres, então o laço de
+ * gerações não copia indivíduos nem aloca memória.
+ * * members guarda os slots da população corrente (ordenados pelo fitness
+ * após a redução) e offspring os slots livres onde a próxima geração é
+ * escrita. A capacidade é fixa: pop_size + número de filhos por geração.
+ */
+struct population_storage
+{
+    int number_of_jobs = 0;
+    int capacity = 0;
+
+    /// Arena única: [listas de atividades | inícios | términos].
+    std::vector<int> arena;
+    std::vector<double> fitness;
+    /// 1 se o fitness do slot veio do cache de fitness e o cronograma na arena
+    /// ainda não foi decodificado (é de um ocupante anterior do slot).
+    std::vector<unsigned char> schedule_pending;
+    /// 1 se a próxima avaliação do slot deve aplicar o forward-backward
+    /// improvement (sorteado na thread principal antes da avaliação).
+    std::vector<unsigned char> justify;
+    /// 1 se o cronograma do slot já passou pelo forward-backward improvement.
+    std::vector<unsigned char> justified;
+
+    std::vector<int> members;
+    std::vector<int> offspring;
+
+    /// Buffers de trabalho: permutações de índices (seleção, redução) e
+    /// posições na lista (verificação de precedência na mutação).
+    std::vector<int> order;
+    std::vector<int> positions;
+
+    /// Carimbos de geração por atividade: marcam pertinência (ex.: atividades
+    /// já copiadas para um filho) sem precisar limpar um vetor a cada uso.
+    std::vector<unsigned int> stamps;
+    unsigned int current_stamp = 0;
+
+    /// Checkpoints do serial SGS por slot (desativados até configure()).
+    schedule_checkpoints checkpoints;
+
+    /// Com listas canônicas (uma por cronograma), a redução descarta filhos
+    /// iguais a um indivíduo já mantido, enquanto houver outros para ocupar a
+    /// população.
+    bool deduplicate = false;
+    /// Hash da lista de cada slot e slots repetidos (buffers de reduce e
+    /// distinct_members).
+    std::vector<std::uint64_t> list_hashes;
+    std::vector<int> duplicates;
+    /// Quantos slots a última redução achou repetidos.
+    int last_duplicates = 0;
+
+    /**
+     * @brief Reserva a arena para pop_size membros e offspring_size filhos.
+     * Os slots [0, pop_size) começam como membros e os demais como livres.
+     */
+    void allocate(int pop_size, int offspring_size, int jobs) {
+        number_of_jobs = jobs;
+        capacity = pop_size + offspring_size;
+
+        arena.assign((size_t)3 * capacity * number_of_jobs, -1);
+        fitness.assign(capacity, std::numeric_limits<double>::infinity());
+        schedule_pending.assign(capacity, 0);
+        justify.assign(capacity, 0);
+        justified.assign(capacity, 0);
+
+        members.resize(pop_size);
+        offspring.resize(offspring_size);
+        for (int i = 0; i < pop_size; ++i) members[i] = i;
+        for (int i = 0; i < offspring_size; ++i) offspring[i] = pop_size + i;
+
+        order.reserve(capacity);
+        list_hashes.assign(capacity, 0);
+        stamps.assign(number_of_jobs, 0);
+        current_stamp = 0;
+
+        checkpoints.configure(capacity, number_of_jobs, 0);
+    }
+
+    /// @brief Novo carimbo; zera os carimbos só quando o contador dá a volta.
+    unsigned int next_stamp() {
+        if (++current_stamp == 0) {
+            std::fill(stamps.begin(), stamps.end(), 0);
+            current_stamp = 1;
+        }
+        return current_stamp;
+    }
+
+    int *activity_list(int slot) { return arena.data() + (size_t)slot * number_of_jobs; }
+    const int *activity_list(int slot) const { return arena.data() + (size_t)slot * number_of_jobs; }
+
+    int *start_times(int slot) { return arena.data() + ((size_t)capacity + slot) * number_of_jobs; }
+    const int *start_times(int slot) const { return arena.data() + ((size_t)capacity + slot) * number_of_jobs; }
+
+    int *finish_times(int slot) { return arena.data() + ((size_t)2 * capacity + slot) * number_of_jobs; }
+    const int *finish_times(int slot) const { return arena.data() + ((size_t)2 * capacity + slot) * number_of_jobs; }
+
+    /// @brief Slot do melhor membro (members está ordenado após a redução).
+    int best() const { return members.front(); }
+
+    /// @brief Slot do pior membro.
+    int worst() const { return members.back(); }
+
+    /**
+     * @brief Copia lista, cronograma e fitness de um slot (possivelmente de
+     * outra população com o mesmo number_of_jobs) para o slot 'to'.
+     */
+    void copy_slot(const population_storage &from_population, int from, int to) {
+        std::copy_n(from_population.activity_list(from), number_of_jobs, activity_list(to));
+        std::copy_n(from_population.start_times(from), number_of_jobs, start_times(to));
+        std::copy_n(from_population.finish_times(from), number_of_jobs, finish_times(to));
+        fitness[to] = from_population.fitness[from];
+        schedule_pending[to] = from_population.schedule_pending[from];
+        justified[to] = from_population.justified[from];
+        checkpoints.invalidate(to);
+    }
+
+    /**
+     * @brief Elitismo + seleção por índices: une membros e filhos, ordena pelo
+     * fitness (empates pelo slot, para um resultado determinístico) e mantém os
+     * members.size() melhores. Os slots descartados viram os novos slots livres.
+     * * Com deduplicate, um slot com a mesma lista de um anterior na ordem vai
+     * para depois dos distintos (continua disponível se faltarem indivíduos
+     * distintos), mas antes dos de fitness infinito, que não foram avaliados.
+     */
+    void reduce() {
+        size_t pop_size = members.size();
+
+        order.assign(members.begin(), members.end());
+        order.insert(order.end(), offspring.begin(), offspring.end());
+        std::sort(order.begin(), order.end(), [&](int a, int b) {
+            if (fitness[a] != fitness[b]) return fitness[a] < fitness[b];
+            return a < b;
+        });
+
+        if (deduplicate) {
+            duplicates.clear();
+            size_t kept = 0;
+            for (size_t i = 0; i < order.size(); ++i) {
+                if (duplicate_of_previous(order.data(), kept, order[i])) duplicates.push_back(order[i]);
+                else order[kept++] = order[i];
+            }
+            // kept termina nos de fitness infinito; as duplicatas entram antes deles
+            size_t finite = kept;
+            while (finite > 0 && fitness[order[finite - 1]] == std::numeric_limits<double>::infinity()) finite--;
+            std::copy(duplicates.begin(), duplicates.end(), order.begin() + kept);
+            std::rotate(order.begin() + finite, order.begin() + kept, order.begin() + kept + duplicates.size());
+            last_duplicates = (int)duplicates.size();
+        }
+
+        std::copy(order.begin(), order.begin() + pop_size, members.begin());
+        std::copy(order.begin() + pop_size, order.end(), offspring.begin());
+    }
+
+    /**
+     * @brief Número de listas distintas entre os membros (cronogramas
+     * distintos, quando as listas são canônicas).
+     */
+    int distinct_members() {
+        int distinct = 0;
+        for (size_t i = 0; i < members.size(); ++i) {
+            if (!duplicate_of_previous(members.data(), i, members[i])) distinct++;
+        }
+        return distinct;
+    }
+
+    private:
+    /**
+     * @brief Verdadeiro se a lista de slot é igual à de algum dos 'count'
+     * primeiros slots de sorted (ordenados pelo fitness). Só os de mesmo
+     * fitness podem ser iguais; a comparação completa só é feita quando os
+     * hashes batem. Calcula e guarda o hash de slot.
+     */
+    bool duplicate_of_previous(const int *sorted, size_t count, int slot) {
+        list_hashes[slot] = hash_activity_list(activity_list(slot), number_of_jobs);
+        if (fitness[slot] == std::numeric_limits<double>::infinity()) return false;
+
+        for (size_t k = count; k-- > 0 && fitness[sorted[k]] == fitness[slot];) {
+            int other = sorted[k];
+            if (list_hashes[other] == list_hashes[slot] &&
+                std::memcmp(activity_list(other), activity_list(slot), sizeof(int) * number_of_jobs) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
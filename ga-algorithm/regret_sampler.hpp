@@ -0,0 +1,89 @@
+#pragma once
+
+#include <vector>
+
+/**
+ * @brief Amostrador ponderado do conjunto de elegíveis por arrependimento
+ * (regret-based biased random sampling) sobre duas árvores de Fenwick.
+ * * Cada item tem um posto (rank) fixo e uma chave (ex.: LFT), com postos em
+ * ordem crescente de chave. O peso de um item elegível é
+ * (maior chave entre os elegíveis) - chave + 1, como no sorteio por LFT do
+ * artigo. Como esse máximo muda a cada inserção/remoção, não guardamos os
+ * pesos: as árvores acumulam a contagem e a soma das chaves, e o peso de um
+ * bloco é contagem * (máximo + 1) - soma. Inserir, remover e sortear custam
+ * O(log n).
+ */
+struct regret_sampler
+{
+    /// @brief Limpa o conjunto para itens com postos em [0, number_of_ranks).
+    void reset(int number_of_ranks) {
+        size = 1;
+        while (size < number_of_ranks) size *= 2;
+        top_bit = size / 2;
+
+        tree.assign(size + 1, {0, 0});
+        number_of_items = 0;
+        total_keys = 0;
+    }
+
+    bool empty() const { return number_of_items == 0; }
+
+    void insert(int rank, long long key) { update(rank, 1, key); }
+
+    void erase(int rank, long long key) { update(rank, -1, -key); }
+
+    /// @brief Maior posto presente (o elegível de maior chave).
+    int highest_rank() const {
+        int pos = 0;
+        long long k = number_of_items;
+        for (int step = top_bit; step > 0; step /= 2) {
+            int next = pos + step;
+            bool take = tree[next].count < k;
+            k -= take ? tree[next].count : 0;
+            pos = take ? next : pos;
+        }
+        return pos;
+    }
+
+    /// @brief Soma dos pesos de todos os elegíveis, dada a maior chave.
+    long long total_weight(long long max_key) const {
+        return number_of_items * (max_key + 1) - total_keys;
+    }
+
+    /**
+     * @brief Posto do item cujo intervalo acumulado de pesos contém r
+     * (0 <= r < total_weight(max_key)).
+     */
+    int sample(long long r, long long max_key) const {
+        int pos = 0;
+        for (int step = top_bit; step > 0; step /= 2) {
+            int next = pos + step;
+            long long weight = tree[next].count * (max_key + 1) - tree[next].key_sum;
+            bool take = weight <= r;
+            r -= take ? weight : 0;
+            pos = take ? next : pos;
+        }
+        return pos;
+    }
+
+    private:
+    /// Tamanho da árvore: potência de dois >= número de postos, para que a
+    /// descida nunca saia do vetor e dispense testes de limite (sem desvios).
+    int size = 0;
+    int top_bit = 1;
+    long long number_of_items = 0;
+    long long total_keys = 0;
+
+    /// Contagem e soma das chaves de cada bloco, lado a lado na memória.
+    struct block { long long count; long long key_sum; };
+    std::vector<block> tree;
+
+    void update(int rank, long long delta_count, long long delta_key) {
+        number_of_items += delta_count;
+        total_keys += delta_key;
+        for (int i = rank + 1; i <= size; i += i & -i) {
+            tree[i].count += delta_count;
+            tree[i].key_sum += delta_key;
+        }
+    }
+};
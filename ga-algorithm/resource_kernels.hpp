@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define RESOURCE_KERNELS_X86 1
+#endif
+
+/**
+ * @brief Núcleos de verificação e reserva do perfil de recursos
+ * (resource_profile), com versão escalar, SSE2 e AVX2 escolhida em tempo de
+ * execução.
+ * * O perfil guarda a disponibilidade segmento a segmento, com os recursos de
+ * um segmento contíguos e completados com zeros até um múltiplo de 4 (stride).
+ * Os segmentos [first, last) formam então um vetor plano de
+ * (last - first) * stride inteiros, e a demanda da atividade é repetida no
+ * mesmo formato num padrão de period inteiros (múltiplo de 8 e de stride). A
+ * verificação de uma janela vira uma comparação lane a lane "demanda >
+ * disponível" que os núcleos vetoriais fazem 4 ou 8 lanes por vez: com 4
+ * recursos, um registrador AVX2 cobre dois segmentos inteiros. A verificação
+ * para no primeiro segmento que começa depois da janela, como o laço
+ * original, sem localizar antes o fim da janela.
+ * * As lanes de preenchimento têm demanda 0 e disponibilidade 0, então nunca
+ * acusam violação nem mudam com a reserva.
+ */
+namespace resource_kernels {
+
+/**
+ * @brief Primeiro segmento sem recurso para o padrão entre os que começam
+ * em first e têm início < end (os que a janela toca), ou -1 se a atividade cabe.
+ */
+using first_violation_fn = int (*)(const int *available, int stride, const int *times, int segments, int first,
+                                   int end, const int *pattern);
+/// @brief Subtrai o padrão da disponibilidade dos segmentos [first, last).
+using book_fn = void (*)(int *available, int stride, int first, int last, const int *pattern, int period);
+
+struct kernel_set
+{
+    const char *name;
+    first_violation_fn first_violation;
+    book_fn book;
+};
+
+/// @brief Os laços originais, segmento a segmento e recurso a recurso.
+inline int scalar_first_violation(const int *available, int stride, const int *times, int segments, int first,
+                                  int end, const int *pattern) {
+    for (int i = first; i < segments && times[i] < end; ++i) {
+        const int *segment = available + (std::size_t)i * stride;
+        for (int k = 0; k < stride; ++k) {
+            if (pattern[k] > segment[k]) return i;
+        }
+    }
+    return -1;
+}
+
+inline void scalar_book(int *available, int stride, int first, int last, const int *pattern, int) {
+    for (int i = first; i < last; ++i) {
+        int *segment = available + (std::size_t)i * stride;
+        for (int k = 0; k < stride; ++k) segment[k] -= pattern[k];
+    }
+}
+
+#ifdef RESOURCE_KERNELS_X86
+
+/// @brief Algum recurso do segmento (stride lanes, 4 por vez) sem capacidade.
+__attribute__((target("sse2"))) inline bool sse2_violates(const int *segment, int stride, const int *pattern) {
+    for (int k = 0; k < stride; k += 4) {
+        __m128i request = _mm_loadu_si128((const __m128i *)(pattern + k));
+        __m128i free = _mm_loadu_si128((const __m128i *)(segment + k));
+        if (_mm_movemask_epi8(_mm_cmpgt_epi32(request, free))) return true;
+    }
+    return false;
+}
+
+__attribute__((target("sse2"))) inline int sse2_first_violation(const int *available, int stride, const int *times,
+                                                                 int segments, int first, int end,
+                                                                 const int *pattern) {
+    for (int i = first; i < segments && times[i] < end; ++i) {
+        if (sse2_violates(available + (std::size_t)i * stride, stride, pattern)) return i;
+    }
+    return -1;
+}
+
+// Na reserva a faixa é contígua: os blocos de 4 (ou 8) lanes percorrem os
+// segmentos como um vetor plano, com o padrão repetido a cada period lanes.
+
+__attribute__((target("sse2"))) inline void sse2_book(int *available, int stride, int first, int last,
+                                                      const int *pattern, int period) {
+    int *lanes = available + (std::size_t)first * stride;
+    std::size_t count = (std::size_t)(last - first) * stride;
+    int p = 0;
+    for (std::size_t i = 0; i < count; i += 4) {
+        __m128i request = _mm_loadu_si128((const __m128i *)(pattern + p));
+        __m128i free = _mm_loadu_si128((const __m128i *)(lanes + i));
+        _mm_storeu_si128((__m128i *)(lanes + i), _mm_sub_epi32(free, request));
+        p += 4;
+        if (p == period) p = 0;
+    }
+}
+
+/**
+ * @brief Com 4 recursos (stride 4), compara dois segmentos por instrução
+ * enquanto os dois estiverem na janela; nos outros casos, 8 lanes de um
+ * segmento por vez.
+ */
+__attribute__((target("avx2"))) inline int avx2_first_violation(const int *available, int stride, const int *times,
+                                                                 int segments, int first, int end,
+                                                                 const int *pattern) {
+    int i = first;
+    if (stride == 4) {
+        __m256i pair_request = _mm256_loadu_si256((const __m256i *)pattern);
+        for (; i + 1 < segments && times[i + 1] < end; i += 2) {
+            __m256i free = _mm256_loadu_si256((const __m256i *)(available + (std::size_t)i * 4));
+            unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpgt_epi32(pair_request, free));
+            if (mask) return i + (__builtin_ctz(mask) >= 16);
+        }
+        if (i < segments && times[i] < end && sse2_violates(available + (std::size_t)i * 4, 4, pattern)) return i;
+        return -1;
+    }
+    for (; i < segments && times[i] < end; ++i) {
+        const int *segment = available + (std::size_t)i * stride;
+        int k = 0;
+        for (; k + 8 <= stride; k += 8) {
+            __m256i request = _mm256_loadu_si256((const __m256i *)(pattern + k));
+            __m256i free = _mm256_loadu_si256((const __m256i *)(segment + k));
+            if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(request, free))) return i;
+        }
+        if (k < stride && sse2_violates(segment + k, 4, pattern + k)) return i;
+    }
+    return -1;
+}
+
+__attribute__((target("avx2"))) inline void avx2_book(int *available, int stride, int first, int last,
+                                                      const int *pattern, int period) {
+    int *lanes = available + (std::size_t)first * stride;
+    std::size_t count = (std::size_t)(last - first) * stride;
+    std::size_t i = 0;
+    int p = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i request = _mm256_loadu_si256((const __m256i *)(pattern + p));
+        __m256i free = _mm256_loadu_si256((const __m256i *)(lanes + i));
+        _mm256_storeu_si256((__m256i *)(lanes + i), _mm256_sub_epi32(free, request));
+        p += 8;
+        if (p == period) p = 0;
+    }
+    if (i < count) {
+        __m128i request = _mm_loadu_si128((const __m128i *)(pattern + p));
+        __m128i free = _mm_loadu_si128((const __m128i *)(lanes + i));
+        _mm_storeu_si128((__m128i *)(lanes + i), _mm_sub_epi32(free, request));
+    }
+}
+
+#endif
+
+/// @brief Todos os núcleos que a CPU atual executa, do mais simples ao mais largo.
+inline const std::vector<const kernel_set *> &supported_kernels() {
+    static const kernel_set scalar = {"scalar", scalar_first_violation, scalar_book};
+#ifdef RESOURCE_KERNELS_X86
+    static const kernel_set sse2 = {"sse2", sse2_first_violation, sse2_book};
+    static const kernel_set avx2 = {"avx2", avx2_first_violation, avx2_book};
+#endif
+    static const std::vector<const kernel_set *> kernels = [] {
+        std::vector<const kernel_set *> list = {&scalar};
+#ifdef RESOURCE_KERNELS_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("sse2")) list.push_back(&sse2);
+        if (__builtin_cpu_supports("avx2")) list.push_back(&avx2);
+#endif
+        return list;
+    }();
+    return kernels;
+}
+
+/// @brief O núcleo mais largo suportado (usado por padrão pelos perfis).
+inline const kernel_set *best_kernel() { return supported_kernels().back(); }
+
+} // namespace resource_kernels
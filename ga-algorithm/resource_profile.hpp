@@ -0,0 +1,164 @@
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+#include "resource_kernels.hpp"
+
+/**
+ * @brief Perfil de recursos esparso (função degrau / "skyline").
+ * * Substitui a matriz densa R_kt (recursos x horizonte). Guarda apenas os
+ * pontos de quebra onde a disponibilidade muda: o segmento i cobre o
+ * intervalo [times[i], times[i+1]) (o último segmento vai até o infinito) e a
+ * disponibilidade do recurso k nesse segmento fica em available[i * stride + k]
+ * (stride = número de recursos arredondado para múltiplo de 4; as lanes
+ * extras ficam em 0).
+ * * As verificações e reservas de uma janela passam por um núcleo de
+ * resource_kernels (escalar, SSE2 ou AVX2; por padrão o mais largo que a CPU
+ * suporta), que compara vários recursos e segmentos por instrução. Os
+ * decodificadores especializados passam o número de recursos como parâmetro
+ * de template (fits<K>, first_violation_end<K>, book<K>); com K > 0 o laço
+ * sobre os recursos é gerado desenrolado, sem passar pelos núcleos.
+ * * Cada reserva cria no máximo dois pontos de quebra, então a memória é
+ * proporcional ao número de atividades agendadas e não ao horizonte. Consultas
+ * e reservas custam O(log n) para localizar o segmento inicial mais O(número
+ * de segmentos cobertos pela janela).
+ */
+struct resource_profile
+{
+    int number_of_resources = 0;
+    /// Inteiros por segmento em available (múltiplo de 4).
+    int stride = 0;
+    /// Tamanho do padrão de demanda: múltiplo de stride e de 8.
+    int period = 0;
+
+    std::vector<int> times;
+    std::vector<int> available;
+
+    const resource_kernels::kernel_set *kernels = resource_kernels::best_kernel();
+
+    /**
+     * @brief Reinicia o perfil com a capacidade total em [0, infinito).
+     * Reaproveita a memória já alocada pelos vetores.
+     */
+    void reset(const std::vector<int> &capacity) {
+        number_of_resources = (int)capacity.size();
+        stride = (number_of_resources + 3) / 4 * 4;
+        period = stride % 8 == 0 ? stride : 2 * stride;
+        pattern.assign(period, 0);
+        pattern_request = nullptr;
+
+        times.assign(1, 0);
+        available.assign(stride, 0);
+        std::copy(capacity.begin(), capacity.end(), available.begin());
+    }
+
+    /// @brief Índice do segmento que contém o instante t (t >= 0).
+    int segment_at(int t) const {
+        return (int)(std::upper_bound(times.begin(), times.end(), t) - times.begin()) - 1;
+    }
+
+    /**
+     * @brief Verifica se uma atividade cabe no perfil na janela
+     * [start, start + duration).
+     * @param request Vetor com a demanda de cada recurso (number_of_resources
+     * posições).
+     */
+    template <int K = 0> bool fits(int start, int duration, const int *request) const {
+        if constexpr (K > 0) return fixed_first_violation<K>(start, start + duration, request) < 0;
+        load_pattern(request);
+        return kernels->first_violation(available.data(), stride, times.data(), (int)times.size(), segment_at(start),
+                                        start + duration, pattern.data()) < 0;
+    }
+
+    /**
+     * @brief Como fits(), mas diz onde procurar em seguida: retorna -1 se a
+     * atividade cabe em [start, start + duration); senão, o fim do primeiro
+     * segmento da janela sem recurso suficiente (nenhum início antes dele
+     * cabe), ou INT_MAX se esse segmento é o último.
+     */
+    template <int K = 0> int first_violation_end(int start, int duration, const int *request) const {
+        int i;
+        if constexpr (K > 0) {
+            i = fixed_first_violation<K>(start, start + duration, request);
+        } else {
+            load_pattern(request);
+            i = kernels->first_violation(available.data(), stride, times.data(), (int)times.size(), segment_at(start),
+                                         start + duration, pattern.data());
+        }
+        if (i < 0) return -1;
+        return i + 1 < (int)times.size() ? times[i + 1] : INT_MAX;
+    }
+
+    /**
+     * @brief Consome a demanda da atividade na janela [start, start + duration).
+     * Não verifica viabilidade; chame fits() antes.
+     */
+    template <int K = 0> void book(int start, int duration, const int *request) {
+        if (duration <= 0) return;
+
+        int first = split_at(start);
+        int last = split_at(start + duration);
+
+        if constexpr (K > 0) {
+            for (int i = first; i < last; ++i) {
+                int *segment = &available[(size_t)i * fixed_stride<K>()];
+                for (int k = 0; k < K; ++k) segment[k] -= request[k];
+            }
+            return;
+        }
+        load_pattern(request);
+        kernels->book(available.data(), stride, first, last, pattern.data(), period);
+    }
+
+    private:
+    /// Demanda da última consulta no formato dos núcleos (ver resource_kernels)
+    /// e de onde ela veio: o SGS consulta a mesma atividade várias vezes seguidas.
+    mutable std::vector<int> pattern;
+    mutable const int *pattern_request = nullptr;
+
+    /// @brief stride de um perfil de K recursos.
+    template <int K> static constexpr int fixed_stride() { return (K + 3) / 4 * 4; }
+
+    /**
+     * @brief Versão de first_violation dos núcleos para K recursos conhecido
+     * em tempo de compilação (K == number_of_resources): a comparação dos K
+     * recursos é desenrolada e sem desvios.
+     * @return int O primeiro segmento da janela sem recurso, ou -1.
+     */
+    template <int K> int fixed_first_violation(int start, int end, const int *request) const {
+        for (int i = segment_at(start); i < (int)times.size() && times[i] < end; ++i) {
+            const int *segment = &available[(size_t)i * fixed_stride<K>()];
+            bool violated = false;
+            for (int k = 0; k < K; ++k) violated |= request[k] > segment[k];
+            if (violated) return i;
+        }
+        return -1;
+    }
+
+    void load_pattern(const int *request) const {
+        if (request == pattern_request) return;
+        pattern_request = request;
+        for (int offset = 0; offset < period; offset += stride) {
+            std::copy_n(request, number_of_resources, pattern.begin() + offset);
+        }
+    }
+
+    /**
+     * @brief Garante que existe um ponto de quebra em t, dividindo o segmento
+     * que o contém se necessário.
+     * @return int O índice do segmento que começa em t.
+     */
+    int split_at(int t) {
+        int i = segment_at(t);
+        if (times[i] == t) return i;
+
+        size_t K = stride;
+        times.insert(times.begin() + i + 1, t);
+        available.insert(available.begin() + (i + 1) * K, K, 0);
+        std::copy_n(available.begin() + i * K, K, available.begin() + (i + 1) * K);
+
+        return i + 1;
+    }
+};
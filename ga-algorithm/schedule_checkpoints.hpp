@@ -0,0 +1,64 @@
+#pragma once
+
+#include <vector>
+
+/**
+ * @brief Checkpoints do serial SGS por slot da população.
+ * * O serial SGS agenda a activity_list na ordem, então o estado após as
+ * primeiras p posições depende só desse prefixo. A cada interval posições a
+ * decodificação de um slot guarda uma cópia do perfil de recursos e do
+ * conjunto de términos (o checkpoint c vale para as posições [0, c * interval)).
+ * Um filho que compartilha com o pai as primeiras L posições retoma do último
+ * checkpoint do pai com c * interval <= L; os inícios e términos desse prefixo
+ * são lidos do cronograma do pai, já guardado na arena.
+ * * Tudo é indexado pelo slot, como o resto da população: a seleção só troca
+ * índices e os checkpoints continuam valendo. Quem grava uma lista num slot
+ * sem decodificá-la (migração) precisa chamar invalidate.
+ */
+struct schedule_checkpoints
+{
+    struct snapshot
+    {
+        std::vector<int> times;
+        std::vector<int> available;
+        std::vector<int> finish_times;
+    };
+
+    /// Posições entre checkpoints (0 = desativado).
+    int interval = 0;
+    /// Checkpoints por slot: c = 1 .. per_slot, todos antes do fim da lista.
+    int per_slot = 0;
+
+    std::vector<snapshot> snapshots;
+    /// Checkpoints válidos de cada slot (os primeiros saved[slot]).
+    std::vector<int> saved;
+    /// Slot cujo prefixo o filho herdou no crossover (-1 = nenhum).
+    std::vector<int> parent;
+    /// Posições que a última avaliação do slot não precisou decodificar.
+    std::vector<int> reused_positions;
+
+    void configure(int capacity, int number_of_jobs, int checkpoint_interval) {
+        interval = checkpoint_interval > 0 ? checkpoint_interval : 0;
+        per_slot = interval > 0 ? (number_of_jobs - 1) / interval : 0;
+
+        snapshots.resize((size_t)capacity * per_slot);
+        saved.assign(capacity, 0);
+        parent.assign(capacity, -1);
+        reused_positions.assign(capacity, 0);
+    }
+
+    bool enabled() const { return per_slot > 0; }
+
+    snapshot &at(int slot, int c) { return snapshots[(size_t)slot * per_slot + c - 1]; }
+
+    void set_parent(int slot, int parent_slot) {
+        if (enabled()) parent[slot] = parent_slot;
+    }
+
+    /// @brief Descarta os checkpoints de um slot cuja lista foi sobrescrita.
+    void invalidate(int slot) {
+        if (!enabled()) return;
+        saved[slot] = 0;
+        parent[slot] = -1;
+    }
+};
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+/**
+ * @brief Leitor de texto linha a linha sobre um buffer (ex.: mapped_file).
+ * * Lê inteiros direto dos bytes, sem montar strings nem streams. O cursor
+ * nunca passa de uma linha para a outra sozinho: quem chama decide quando
+ * avançar com next_line(), o que permite validar o fim de cada linha. Um '#'
+ * inicia um comentário até o fim da linha.
+ */
+struct text_scanner
+{
+    const char *cursor;
+    const char *end;
+    int line = 1;
+
+    text_scanner(const char *data, std::size_t size) : cursor(data), end(data + size) {}
+
+    bool at_end() const { return cursor >= end; }
+
+    /// @brief Pula espaços, tabs e '\r' dentro da linha corrente.
+    void skip_spaces() {
+        while (cursor < end && (*cursor == ' ' || *cursor == '\t' || *cursor == '\r')) ++cursor;
+    }
+
+    /// @brief Verdadeiro se só restam espaços ou comentário na linha corrente.
+    bool at_line_end() {
+        skip_spaces();
+        return cursor >= end || *cursor == '\n' || *cursor == '#';
+    }
+
+    /// @brief Avança para o início da próxima linha.
+    void next_line() {
+        const char *newline = static_cast<const char *>(std::memchr(cursor, '\n', end - cursor));
+        if (newline) {
+            cursor = newline + 1;
+            ++line;
+        } else {
+            cursor = end;
+        }
+    }
+
+    /// @brief Primeiro caractere não branco da linha corrente ('\0' se vazia).
+    char peek() {
+        skip_spaces();
+        return (cursor < end && *cursor != '\n') ? *cursor : '\0';
+    }
+
+    /**
+     * @brief Verifica se, após os espaços iniciais, a linha começa com prefix.
+     * Em caso positivo o cursor fica logo após o prefixo.
+     */
+    bool consume(const char *prefix) {
+        skip_spaces();
+        std::size_t length = std::strlen(prefix);
+        if ((std::size_t)(end - cursor) < length || std::memcmp(cursor, prefix, length) != 0) return false;
+        cursor += length;
+        return true;
+    }
+
+    /// @brief Move o cursor para logo após o próximo c da linha corrente.
+    bool skip_past(char c) {
+        while (cursor < end && *cursor != '\n') {
+            if (*cursor++ == c) return true;
+        }
+        return false;
+    }
+
+    /// @brief Lê um inteiro (com sinal opcional) na linha corrente.
+    bool read_int(int &value) {
+        skip_spaces();
+        const char *p = cursor;
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+')) negative = (*p++ == '-');
+        if (p >= end || *p < '0' || *p > '9') return false;
+
+        long long number = 0;
+        while (p < end && *p >= '0' && *p <= '9') {
+            number = number * 10 + (*p++ - '0');
+            if (number > 2147483647LL) return false;
+        }
+        // "12abc" não é um inteiro
+        if (p < end && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n' && *p != '#') return false;
+
+        value = (int)(negative ? -number : number);
+        cursor = p;
+        return true;
+    }
+};
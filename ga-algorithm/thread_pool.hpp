@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Pool de threads persistentes para laços paralelos do GA.
+ * * As threads são criadas uma única vez e ficam dormindo entre os lotes.
+ * parallel_for distribui os índices dinamicamente (contador atômico), então
+ * uma thread que termina cedo "rouba" o próximo índice livre. A thread que
+ * chama parallel_for também trabalha, como worker 0.
+ * * O worker recebido pela tarefa identifica a thread (0 .. size()-1) e serve
+ * para indexar buffers de trabalho próprios de cada thread.
+ */
+struct thread_pool
+{
+    explicit thread_pool(int number_of_threads = 1) { resize(number_of_threads); }
+
+    ~thread_pool() { stop(); }
+
+    thread_pool(const thread_pool &) = delete;
+    thread_pool &operator=(const thread_pool &) = delete;
+
+    /// @brief Número total de workers, incluindo a thread chamadora.
+    int size() const { return (int)workers.size() + 1; }
+
+    /// @brief Recria o pool com o número de threads pedido (mínimo 1).
+    void resize(int number_of_threads) {
+        if (number_of_threads < 1) number_of_threads = 1;
+        if (number_of_threads == size()) return;
+
+        stop();
+        stopping = false;
+        for (int w = 1; w < number_of_threads; ++w) {
+            workers.emplace_back([this, w, seen = generation] { worker_loop(w, seen); });
+        }
+    }
+
+    /**
+     * @brief Executa task(i, worker) para todo i em [0, count) e espera o fim.
+     * Com um único worker, roda direto na thread chamadora.
+     */
+    void parallel_for(int count, const std::function<void(int, int)> &task) {
+        if (count <= 0) return;
+
+        if (workers.empty() || count == 1) {
+            for (int i = 0; i < count; ++i) task(i, 0);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = &task;
+            job_count = count;
+            next_index.store(0);
+            running = (int)workers.size();
+            ++generation;
+        }
+        wake.notify_all();
+
+        drain(0);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return running == 0; });
+        job = nullptr;
+    }
+
+    private:
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+
+    const std::function<void(int, int)> *job = nullptr;
+    int job_count = 0;
+    std::atomic<int> next_index{0};
+    int running = 0;
+    unsigned long long generation = 0;
+    bool stopping = false;
+
+    void drain(int worker) {
+        int i;
+        while ((i = next_index.fetch_add(1)) < job_count) {
+            (*job)(i, worker);
+        }
+    }
+
+    void worker_loop(int worker, unsigned long long seen) {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&] { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+            }
+
+            drain(worker);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--running == 0) done.notify_one();
+            }
+        }
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto &t : workers) t.join();
+        workers.clear();
+    }
+};